@@ -53,6 +53,9 @@
 
 #include <vector>
 #include <map>
+#ifdef __LINBOX_USE_OPENMP
+#include <omp.h>
+#endif
 
 namespace LinBox
 {
@@ -74,14 +77,14 @@ namespace LinBox
 		public:
 			FactorMult() :
 				fieldP(NULL),intP(NULL)
-				,multiplicity(0),dep(NULL)
+				,multiplicity(0),dep(NULL),rank(0)
 			{}
 			FactorMult( FieldPoly* FP, IntPoly* IP, unsigned long m, FactorMult<FieldPoly,IntPoly>*d) :
-				fieldP(FP), intP(IP), multiplicity(m), dep(d)
+				fieldP(FP), intP(IP), multiplicity(m), dep(d), rank(0)
 			{}
 
 			FactorMult (const FactorMult<FieldPoly>& FM) :
-				fieldP(FM.fieldP), intP(FM.intP), multiplicity(FM.multiplicity), dep(FM.dep)
+				fieldP(FM.fieldP), intP(FM.intP), multiplicity(FM.multiplicity), dep(FM.dep), rank(FM.rank)
 			{}
 
 			int update (const size_t n, int * goal)
@@ -118,6 +121,7 @@ namespace LinBox
 			IntPoly                         *intP;
 			unsigned long                   multiplicity;
 			FactorMult<FieldPoly, IntPoly>  *dep;
+			unsigned long                   rank; //!< of fieldP(A), once computed
 
 			std::ostream& write(std::ostream& os)
 			{
@@ -365,6 +369,36 @@ namespace LinBox
 			}
 		}
 
+		/* Ranks of the Pi(A) for the factors Pi, into their rank field.
+		 * They are computed concurrently; each uses its own random
+		 * preconditioners. Within the parallel region, commentator()
+		 * gives each thread its own silent commentator, so the reports
+		 * of rank() do not touch the shared one.
+		 */
+		template <class BlackBox, class FieldPoly, class IntPoly>
+		static void factorRanks( const BlackBox& A,
+					 const std::vector<FactorMult<FieldPoly,IntPoly>*>& factors,
+					 const Method::Blackbox &M)
+		{
+			const typename BlackBox::Field& F = A.field();
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for schedule(dynamic) if(factors.size() > 1)
+#endif
+			for (long i = 0; i < (long)factors.size(); ++i){
+				FactorMult<FieldPoly,IntPoly>* f = factors[(size_t)i];
+				long unsigned int r;
+				/* The matrix Pi (A) */
+				if ((f->fieldP->size() == 2) && F.isZero (f->fieldP->operator[](0))){
+					rank (r, A, M) ;
+				}
+				else {
+					PolynomialBB<BlackBox, FieldPoly > PA (A, *f->fieldP);
+					rank (r, PA, M) ;
+				}
+				f->rank = r;
+			}
+		}
+
 		template <class BlackBox, class FieldPoly, class IntPoly>
 		static void findMultiplicities( const BlackBox& A,
 					 std::multimap<unsigned long, FactorMult<FieldPoly,IntPoly>* >& factCharPoly,
@@ -383,24 +417,13 @@ namespace LinBox
 			size_t n = A.coldim();
 
 			/* Rank for the linear factors */
+			std::vector<FactorMult<FieldPoly,IntPoly>*> ranked;
 			while ( ( factnum > 1 ) && ( itf->first == 1) ){
 
 				lead_it = leadingBlocks.find(itf->second);
 				if ( lead_it != leadingBlocks.end())
 					lead_it->second = true;
-				long unsigned int r;
-
-				/* The matrix Pi (A) */
-				if (F.isZero (itf->second->fieldP->operator[](0))){
-					rank (r, A, M) ;
-				}
-				else {
-					PolynomialBB<BlackBox, FieldPoly > PA (A, *itf->second->fieldP);
-					rank (r, PA,  M) ;
-				}
-				itf->second->multiplicity =(size_t) r;
-
-				//std::cerr<<"Rank 1 : "<<*itf->second->fieldP<<" --> "<<r<<std::endl;
+				ranked.push_back (itf->second);
 				--factnum;
 				++itf;
 			}
@@ -411,18 +434,32 @@ namespace LinBox
 				lead_it = leadingBlocks.find (itf->second);
 				if ( lead_it != leadingBlocks.end())
 					lead_it->second = true;
-
-				PolynomialBB<BlackBox, FieldPoly > PA (A, *itf->second->fieldP);
-				long unsigned int r;
-				rank (r, PA,  M);
-
-				itf->second->multiplicity =(size_t)r;
-				//std::cerr<<"Rank > 1 : "<<*itf->second->intP<<" --> "<<r<<std::endl;
-
+				ranked.push_back (itf->second);
 				--factnum;
 				++itf;
 			}
 
+			// The ranks of the Pi(A) are independent problems
+			factorRanks (A, ranked, M);
+			for (size_t i = 0; i < ranked.size(); ++i)
+				ranked[i]->multiplicity = ranked[i]->rank;
+
+			// The leading blocks which have not been computed need one more rank:
+			// that of the last computed multiplicity of their sequence
+			std::vector<FactorMult<FieldPoly,IntPoly>*> extra;
+			for (lead_it = leadingBlocks.begin(); lead_it != leadingBlocks.end(); ++lead_it){
+				if (lead_it->second) continue;
+				FactorMult<FieldPoly,IntPoly>* currFFM = lead_it->first;
+				while (currFFM->dep!=NULL){
+					if (currFFM->dep->multiplicity != 0)
+						break;
+					currFFM = currFFM->dep;
+				}
+				if (currFFM->dep != NULL)
+					extra.push_back (currFFM);
+			}
+			factorRanks (A, extra, M);
+
 			// update the multiplicities
 			for (lead_it = leadingBlocks.begin(); lead_it != leadingBlocks.end(); ++lead_it){
 
@@ -439,14 +476,9 @@ namespace LinBox
 					}
 					if (currFFM->dep != NULL){
 
-						// Need one more computation:
-						PolynomialBB<BlackBox, FieldPoly > PA (A, *currFFM->fieldP);
-						long unsigned int r;
-						rank (r, PA, M) ;
-						//std::cerr<<"extra factor : "<<*currFFM->fieldP<<" --> "<<r<<std::endl;
-
+						// its rank is in extra
 						int tmp = (int)currFFM->multiplicity;
-						currFFM->multiplicity =(size_t) r;
+						currFFM->multiplicity = currFFM->rank;
 						currFFM->update (n,&goal);
 						currFFM->multiplicity = (size_t)tmp;
 					}
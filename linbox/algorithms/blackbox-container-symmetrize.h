@@ -40,7 +40,11 @@
 #ifndef __LINBOX_blackbox_container_symmetrize_H
 #define __LINBOX_blackbox_container_symmetrize_H
 
+#include <algorithm>
+#include <memory>
+
 #include "linbox/algorithms/blackbox-container-base.h"
+#include "linbox/blackbox/fused-sparse.h"
 
 namespace LinBox
 {
@@ -59,6 +63,9 @@ namespace LinBox
 	 (A^t (A this->u))^t (A^t (A this->u)) = this->u^t (A^t A)^2 this->u
 	 etc.
 	 \endcode
+	 * When the entries of A can be enumerated (see \c FusedSparseCategory),
+	 * \f$w = A^T A u\f$ is computed by a \c FusedNormal in one traversal of
+	 * A, and the sequence is \f$u^T u, u^T w, w^T w\f$, then \f$u \gets w\f$.
 	 */
 
 	template<class Field, class _Blackbox, class RandIter = typename Field::RandIter>
@@ -71,20 +78,44 @@ namespace LinBox
 
 		template<class Vector>
 		BlackboxContainerSymmetrize (const Blackbox *D, const Field &F, const Vector &u0) :
-			BlackboxContainerBase<Field, Blackbox> (D, F)
+			BlackboxContainerBase<Field, Blackbox> (D, F), _w(F)
 		{
 		       	init (u0);
 	       	}
 
 		//BlackboxContainerSymmetrize (const Blackbox *D, const Field &F, RandIter &g = typename Field::RandIter(_field) )
 		BlackboxContainerSymmetrize (const Blackbox *D, const Field &F, RandIter &g = typename Field::RandIter() ) :
-			BlackboxContainerBase<Field, Blackbox> (D, F)
+			BlackboxContainerBase<Field, Blackbox> (D, F), _w(F)
 		{
 		       	init (g);
 	       	}
 
 	private:
+		typedef typename FusedSparseCategory<Blackbox>::Tag FusedTag;
+
 		void _launch ()
+		{
+			_launch (FusedTag());
+		}
+
+		void _launch (SolutionTags::Local)
+		{
+			if (this->casenumber) {
+				this->casenumber = 0;
+				if (!_normal)
+					_normal.reset (new FusedNormal<Field> (fused (*this->_BB)));
+				_w.resize (this->u.size());
+				_normal->apply (_w, this->u);
+				this->_VD.dot (this->_value, this->u, _w);
+			}
+			else {
+				this->casenumber = 1;
+				std::copy (_w.begin(), _w.end(), this->u.begin());
+				this->_VD.dot (this->_value, this->u, this->u);
+			}
+		}
+
+		void _launch (SolutionTags::Generic)
 		{
 			if (this->casenumber) {
 				this->casenumber = 0;
@@ -99,6 +130,9 @@ namespace LinBox
 		}
 
 		void _wait () {}
+
+		std::shared_ptr<FusedNormal<Field> > _normal; //!< A^T A, built at first use
+		BlasVector<Field>                   _w;
 	};
 
 }
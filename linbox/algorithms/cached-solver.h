@@ -0,0 +1,313 @@
+/* linbox/algorithms/cached-solver.h
+ * Copyright (C) 2026 the LinBox group
+ *
+ * ========LICENCE========
+ * This file is part of the library LinBox.
+ *
+ * LinBox is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ */
+
+/*! @file algorithms/cached-solver.h
+ * @ingroup algorithms
+ * @brief Solvers keeping the factorization of their matrix between calls.
+ */
+
+#ifndef __LINBOX_cached_solver_H
+#define __LINBOX_cached_solver_H
+
+#include <future>
+#include <memory>
+#include <mutex>
+
+#include "linbox/linbox-config.h"
+#include "linbox/util/debug.h"
+#include "linbox/matrix/dense-matrix.h"
+#include "linbox/matrix/factorized-matrix.h"
+#include "linbox/matrix/matrixdomain/blas-matrix-domain.h"
+#include "linbox/field/field-traits.h"
+#include "linbox/randiter/prime-pool.h"
+#include "linbox/algorithms/matrix-hom.h"
+#include "linbox/algorithms/lifting-container.h"
+#include "linbox/algorithms/rational-reconstruction.h"
+#include "linbox/algorithms/rational-solver.h"
+
+namespace LinBox
+{
+
+	/** \brief Dense matrix over a finite field, factored once.
+	 *
+	 * The \c LQUP factorization of the matrix is computed at construction
+	 * and every \c solve, \c det and \c rank query is answered from it.
+	 * The object is not modified afterwards, so that concurrent solves
+	 * with different right-hand sides are safe.
+	 */
+	template<class _Field>
+	class FieldSolverCache {
+	public:
+		typedef _Field                  Field;
+		typedef typename Field::Element Element;
+
+		//! Factor a copy of \p A
+		FieldSolverCache (const BlasMatrix<Field> & A) :
+			_field(&A.field()), _LU(A)
+		{}
+
+		const Field & field () const { return *_field; }
+
+		size_t rowdim () const { return _LU.rowdim(); }
+		size_t coldim () const { return _LU.coldim(); }
+
+		size_t rank () const { return _LU.getRank(); }
+
+		Element & det (Element & d) const
+		{
+			const Field & F = field();
+			if (rowdim() != coldim() || rank() < rowdim())
+				return F.assign(d, F.zero);
+			const Element * A = _LU.getPointer();
+			const size_t lda = _LU.getStride();
+			const size_t * P = _LU.getP().getPointer();
+			const size_t * Q = _LU.getQ().getPointer();
+			bool odd = false;
+			F.assign(d, F.one);
+			for (size_t i = 0; i < rank(); ++i) {
+				F.mulin(d, A[i*lda+i]);
+				if (P[i] != i) odd = !odd;
+				if (Q[i] != i) odd = !odd;
+			}
+			if (odd) F.negin(d);
+			return d;
+		}
+
+		/** Solve \f$Ax = b\f$.
+		 * @throws LinboxMathInconsistentSystem if the system is inconsistent
+		 */
+		BlasVector<Field> & solve (BlasVector<Field> & x, const BlasVector<Field> & b) const
+		{
+			return _LU.left_solve(x, b);
+		}
+
+		//! Solve \f$AX = B\f$
+		BlasMatrix<Field> & solve (BlasMatrix<Field> & X, const BlasMatrix<Field> & B) const
+		{
+			return _LU.left_solve(X, B);
+		}
+
+	private:
+		const Field       *_field;
+		LQUPMatrix<Field>  _LU;
+	};
+
+	/** \brief Dixon solver for a fixed nonsingular integer matrix.
+	 *
+	 * The inverse of \f$A \bmod p\f$ is the expensive part of a Dixon
+	 * solve; here it is computed once and kept for the next right-hand
+	 * sides. The prime is only changed when \f$A\f$ is singular modulo it
+	 * or when the lifting with it fails.
+	 *
+	 * Memory: the cached inverse takes \f$n^2\f$ field elements. If this
+	 * exceeds \p maxBytes, nothing is kept and each solve computes its own
+	 * inverse; \c release() drops the cache.
+	 *
+	 * \c solve may be called concurrently: the cache is guarded by a
+	 * mutex, and each solve keeps its own reference to the inverse it
+	 * uses, so that a release or a change of prime never invalidates a
+	 * running solve. The inverse is computed outside the mutex by the
+	 * first solve which needs it; the solves arriving meanwhile wait for
+	 * it on a shared future.
+	 *
+	 * The primes are drawn at random from the process-wide @ref PrimePool
+	 * of \p Field.
+	 */
+	template<class _Ring, class _Field = Givaro::Modular<double> >
+	class IntegerSolverCache {
+	public:
+		typedef _Ring                   Ring;
+		typedef _Field                  Field;
+		typedef typename Ring::Element  Integer;
+		typedef BlasMatrix<Ring>        IMatrix;
+		typedef BlasMatrix<Field>       FMatrix;
+
+		/** Copy \p A; nothing is computed until the first query.
+		 * @param A square integer matrix
+		 * @param maxBytes bound on the size of the cached data, 0 for none
+		 * @param maxPrimes number of primes tried before \f$A\f$ is declared singular
+		 */
+		IntegerSolverCache (const IMatrix & A, size_t maxBytes = 0, size_t maxPrimes = DEFAULT_MAXPRIMES) :
+			_ring(A.field()), _A(A), _maxPrimes(maxPrimes), _rank(0), _singular(false),
+			_primes(FieldTraits<Field>::bestBitSize(A.coldim()))
+		{
+			linbox_check(A.rowdim() == A.coldim());
+			const size_t n = A.rowdim();
+			_keep = !maxBytes || n*n*sizeof(typename Field::Element) <= maxBytes;
+		}
+
+		const Ring & ring () const { return _ring; }
+
+		/** Solve \f$Ax = b\f$ over the rationals, \f$x = num/den\f$.
+		 * @return \c SS_OK, \c SS_SINGULAR if \f$A\f$ was singular modulo
+		 * every prime tried, or \c SS_FAILED
+		 */
+		template<class Vector1, class Vector2>
+		SolverReturnStatus solve (Vector1 & num, Integer & den, const Vector2 & b) const
+		{
+			typedef DixonLiftingContainer<Ring, Field, IMatrix, FMatrix> LiftingContainer;
+			linbox_check(b.size() == _A.rowdim());
+			for (size_t trial = 0; trial < _maxPrimes; ++trial) {
+				FactorizationPtr E = _factorization();
+				if (!E)
+					return SS_SINGULAR;
+				LiftingContainer lc(_ring, *E->field, _A, E->inverse, b, integer(E->prime));
+				RationalReconstruction<LiftingContainer> re(lc);
+				if (re.getRational(num, den, 0))
+					return SS_OK;
+				_discard(E);
+			}
+			return SS_FAILED;
+		}
+
+		/** Rank of \f$A\f$: the largest rank modulo the primes tried, which
+		 * is the rank over the integers unless they all divide some
+		 * minor (Monte Carlo).
+		 */
+		size_t rank () const
+		{
+			_factorization();
+			std::lock_guard<std::mutex> guard(_lock);
+			return _rank;
+		}
+
+		//! Drop the cached inverse; running solves keep theirs
+		void release () const
+		{
+			std::lock_guard<std::mutex> guard(_lock);
+			_current.reset();
+		}
+
+	private:
+		struct Factorization {
+			uint64_t      prime;
+			const Field  *field;
+			FMatrix       inverse; //!< \f$A^{-1} \bmod p\f$
+
+			Factorization (uint64_t p, const Field & F, size_t n) :
+				prime(p), field(&F), inverse(F, n, n)
+			{}
+		};
+		typedef std::shared_ptr<const Factorization> FactorizationPtr;
+
+		// the cached inverse, computed if there is none
+		FactorizationPtr _factorization () const
+		{
+			std::unique_lock<std::mutex> guard(_lock);
+			if (_current)
+				return _current;
+			if (_singular)
+				return FactorizationPtr();
+			if (_pending.valid()) {
+				// another thread is computing it
+				std::shared_future<FactorizationPtr> pending = _pending;
+				guard.unlock();
+				return pending.get();
+			}
+			std::promise<FactorizationPtr> promise;
+			_pending = promise.get_future().share();
+			guard.unlock();
+
+			const size_t n = _A.rowdim();
+			FactorizationPtr result;
+			size_t maxRank = 0;
+			try {
+				for (size_t tries = 0; tries < _maxPrimes && !result; ++tries) {
+					guard.lock();
+					const uint64_t p = _primes.entry().prime;
+					const Field & F = _primes.field();
+					guard.unlock();
+
+					std::shared_ptr<Factorization> E(new Factorization(p, F, n));
+					FMatrix Ap(F, n, n);
+					MatrixHom::map(Ap, _A);
+					int nullity;
+					BlasMatrixDomain<Field>(F).invin(E->inverse, Ap, nullity);
+					maxRank = std::max(maxRank, n - (size_t)nullity);
+					if (nullity)
+						_next(p);
+					else
+						result = E;
+				}
+			}
+			catch (...) {
+				// the waiting solves get the exception too
+				if (!guard.owns_lock())
+					guard.lock();
+				_pending = std::shared_future<FactorizationPtr>();
+				guard.unlock();
+				promise.set_exception(std::current_exception());
+				throw;
+			}
+
+			guard.lock();
+			_rank = std::max(_rank, maxRank);
+			if (!result)
+				_singular = true;
+			else if (_keep)
+				_current = result;
+			_pending = std::shared_future<FactorizationPtr>();
+			guard.unlock();
+			promise.set_value(result);
+			return result;
+		}
+
+		// the lifting failed with this prime: use another one
+		void _discard (const FactorizationPtr & E) const
+		{
+			_next(E->prime);
+			std::lock_guard<std::mutex> guard(_lock);
+			if (_current == E)
+				_current.reset();
+		}
+
+		// draw a new prime, unless p was already replaced
+		void _next (uint64_t p) const
+		{
+			std::lock_guard<std::mutex> guard(_lock);
+			if (_primes.entry().prime == p)
+				++_primes;
+		}
+
+		Ring                      _ring;
+		const IMatrix             _A;
+		const size_t              _maxPrimes;
+		bool                      _keep;
+		mutable FactorizationPtr  _current;
+		mutable std::shared_future<FactorizationPtr> _pending; //!< inverse being computed
+		mutable size_t            _rank;
+		mutable bool              _singular;
+		mutable std::mutex        _lock;
+		mutable PrimePoolIterator<Field> _primes; //!< its current prime is the one to use
+	};
+
+} // namespace LinBox
+
+#endif // __LINBOX_cached_solver_H
+
+// Local Variables:
+// mode: C++
+// tab-width: 4
+// indent-tabs-mode: nil
+// c-basic-offset: 4
+// End:
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
@@ -74,6 +74,7 @@ namespace LinBox
 
 			if (this->IterCounter==0) {
 				std::set<Integer> coprimeset;
+				std::vector<Domain> ROUNDdomains; ROUNDdomains.reserve(NN);
 				while(coprimeset.size() < NN) {
 					++primeiter;
 					while(this->Builder_.noncoprime(*primeiter) ) {
@@ -85,16 +86,12 @@ namespace LinBox
 						}
 					}
 					coprime =0;
-					coprimeset.insert(*primeiter);
+					if (coprimeset.insert(*primeiter).second)
+						ROUNDdomains.push_back( CRADomainOf<Domain>(primeiter) );
 				}
-				std::vector<Domain> ROUNDdomains; ROUNDdomains.reserve(NN);
 				std::vector<DomainElement> ROUNDresidues(NN);
-				typename std::vector<DomainElement>::iterator resit=ROUNDresidues.begin();
-				for(std::set<Integer>::const_iterator coprimesetiter = coprimeset.begin(); coprimesetiter != coprimeset.end(); ++coprimesetiter,++resit) {
-					// std::cerr << "With prime: " << *coprimesetiter << std::endl;
-					ROUNDdomains.push_back( Domain(*coprimesetiter) );
-					ROUNDdomains.back().init( *resit );
-				}
+				for(size_t i=0;i<NN;++i)
+					ROUNDdomains[i].init( ROUNDresidues[i] );
 
 #pragma omp parallel for
 				for(size_t i=0;i<NN;++i) {
@@ -113,6 +110,7 @@ namespace LinBox
 			while( ! this->Builder_.terminated() ) {
 				//std::cerr << "Computed: " << this->IterCounter << " primes." << std::endl;
 				std::set<Integer> coprimeset;
+				std::vector<Domain> ROUNDdomains; ROUNDdomains.reserve(NN);
 				while(coprimeset.size() < NN) {
 					++primeiter;
 					while(this->Builder_.noncoprime(*primeiter) ) {
@@ -124,16 +122,12 @@ namespace LinBox
 						}
 					}
 					coprime =0;
-					coprimeset.insert(*primeiter);
+					if (coprimeset.insert(*primeiter).second)
+						ROUNDdomains.push_back( CRADomainOf<Domain>(primeiter) );
 				}
-				std::vector<Domain> ROUNDdomains; ROUNDdomains.reserve(NN);
 				std::vector<DomainElement> ROUNDresidues(NN);
-				typename std::vector<DomainElement>::iterator resit=ROUNDresidues.begin();
-				for(std::set<Integer>::const_iterator coprimesetiter = coprimeset.begin(); coprimesetiter != coprimeset.end(); ++coprimesetiter,++resit) {
-					// std::cerr << "With prime: " << *coprimesetiter << std::endl;
-					ROUNDdomains.push_back( Domain(*coprimesetiter) );
-					ROUNDdomains.back().init( *resit );
-				}
+				for(size_t i=0;i<NN;++i)
+					ROUNDdomains[i].init( ROUNDresidues[i] );
 
 #pragma omp parallel for
 				for(size_t i=0;i<NN;++i) {
@@ -164,6 +158,7 @@ namespace LinBox
 
 			if (this->IterCounter==0) {
 				std::set<Integer> coprimeset;
+				std::vector<Domain> ROUNDdomains; ROUNDdomains.reserve(NN);
 				while(coprimeset.size() < NN) {
 					++primeiter;
 					while(this->Builder_.noncoprime(*primeiter) ) {
@@ -175,18 +170,10 @@ namespace LinBox
 						}
 					}
 					coprime =0;
-					coprimeset.insert(*primeiter);
+					if (coprimeset.insert(*primeiter).second)
+						ROUNDdomains.push_back( CRADomainOf<Domain>(primeiter) );
 				}
-				std::vector<Domain> ROUNDdomains; ROUNDdomains.reserve(NN);
 				std::vector<ElementContainer> ROUNDresidues(NN);
-				typename std::vector<ElementContainer>::iterator resit=ROUNDresidues.begin();
-				for(std::set<Integer>::const_iterator coprimesetiter = coprimeset.begin(); coprimesetiter != coprimeset.end(); ++coprimesetiter,++resit) {
-					// std::cerr << "With prime: " << *coprimesetiter << std::endl;
-					ROUNDdomains.push_back( Domain(*coprimesetiter) );
-					//                     for(typename ElementContainer::iterator reselit = resit->begin();
-					//                         reselit != resit->end(); ++reselit)
-					//                         ROUNDdomains.back().init( *reselit );
-				}
 
 #pragma omp parallel for
 				for(size_t i=0;i<NN;++i) {
@@ -205,6 +192,7 @@ namespace LinBox
 			while( ! this->Builder_.terminated() ) {
 				//std::cerr << "Computed: " << this->IterCounter << " primes." << std::endl;
 				std::set<Integer> coprimeset;
+				std::vector<Domain> ROUNDdomains; ROUNDdomains.reserve(NN);
 				while(coprimeset.size() < NN) {
 					++primeiter;
 					while(this->Builder_.noncoprime(*primeiter) ) {
@@ -216,18 +204,10 @@ namespace LinBox
 						}
 					}
 					coprime =0;
-					coprimeset.insert(*primeiter);
+					if (coprimeset.insert(*primeiter).second)
+						ROUNDdomains.push_back( CRADomainOf<Domain>(primeiter) );
 				}
-				std::vector<Domain> ROUNDdomains; ROUNDdomains.reserve(NN);
 				std::vector<ElementContainer> ROUNDresidues(NN);
-				typename std::vector<ElementContainer>::iterator resit=ROUNDresidues.begin();
-				for(std::set<Integer>::const_iterator coprimesetiter = coprimeset.begin(); coprimesetiter != coprimeset.end(); ++coprimesetiter,++resit) {
-					// std::cerr << "With prime: " << *coprimesetiter << std::endl;
-					ROUNDdomains.push_back( Domain(*coprimesetiter) );
-					//                     for(typename ElementContainer::iterator reselit = resit->begin();
-					//                         reselit != resit->end(); ++reselit)
-					//                         ROUNDdomains.back().init( *reselit );
-				}
 
 #pragma omp parallel for
 				for(size_t i=0;i<NN;++i) {
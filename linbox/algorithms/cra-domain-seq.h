@@ -79,6 +79,17 @@ namespace LinBox
 		}
 	};
 
+	/** \brief Field of the current prime of a prime iterator.
+	 *
+	 * Iterators which carry the field already set up (\c PrimePoolIterator)
+	 * overload this so that the CRA loops do not rebuild it.
+	 */
+	template <class Domain, class PrimeIterator>
+	inline Domain CRADomainOf(const PrimeIterator& primeiter)
+	{
+		return Domain(*primeiter);
+	}
+
         /// No doc.
         /// @ingroup CRA
 	template<class CRABase>
@@ -153,7 +164,7 @@ namespace LinBox
                 if ((IterCounter ==0) && (k !=0)) {
                     --k;
                     ++IterCounter;
-                    Domain D(*primeiter);
+                    Domain D(CRADomainOf<Domain>(primeiter));
                     commentator().report(Commentator::LEVEL_IMPORTANT, INTERNAL_DESCRIPTION) << "With prime " << *primeiter << std::endl;
                     ++primeiter;
 					auto r = CRAResidue<ResultType>::create(D);
@@ -185,7 +196,7 @@ namespace LinBox
                     }
 
                     coprime =0;
-                    Domain D(*primeiter);
+                    Domain D(CRADomainOf<Domain>(primeiter));
                     commentator().report(Commentator::LEVEL_IMPORTANT, INTERNAL_DESCRIPTION) << "With prime " << *primeiter << std::endl;
                     ++primeiter; ++nbprimes;
 
@@ -62,8 +62,9 @@ namespace LinBox
 		Integer& result(Integer &d) { std::cout << "should not be called" << std::endl; return d ;} ; // DON'T TOUCH
 	public:
 
-		EarlyMultipCRA(const unsigned long EARLY=DEFAULT_EARLY_TERM_THRESHOLD) :
-			EarlySingleCRA<Domain>(EARLY), FullMultipCRA<Domain>()
+		EarlyMultipCRA(const unsigned long EARLY=DEFAULT_EARLY_TERM_THRESHOLD,
+			       const size_t batch=DEFAULT_CRA_BATCH_SIZE) :
+			EarlySingleCRA<Domain>(EARLY), FullMultipCRA<Domain>(0.0, batch)
 		{}
 
 		Integer& getModulus(Integer& m)
@@ -207,6 +208,7 @@ namespace LinBox
 				*int_p = ((unsigned long)lrand48()) % 20000;
 
 			std::vector<Integer> e(randv.size());
+			FullMultipCRA<Domain>::flush();
 			/* clear CRAEarlySingle; */
 			EarlySingleCRA<Domain>::occurency_ = 0;
 			EarlySingleCRA<Domain>::nextM_ = 1UL;
@@ -38,12 +38,19 @@
 #include <utility>
 
 #include "linbox/algorithms/lazy-product.h"
+#include "linbox/algorithms/cra-product-tree.h"
 
 namespace LinBox
 {
 
 	/*! NO DOC...
 	 * @ingroup CRA
+	 *
+	 * When the batch size is larger than 1, the residues modulo word size
+	 * primes are first buffered; every \p batch primes, they are
+	 * reconstructed all at once through a \c CRAProductTree shared by all
+	 * the entries (in parallel over the entries) and the batch enters the
+	 * radix shelves as a single modulus.
 	 * @bib
 	 * - Jean-Guillaume Dumas, Thierry Gautier et Jean-Louis Roch.  <i>Generic design
 	 * of Chinese remaindering schemes</i>  PASCO 2010, pp 26-34, 21-23 juillet,
@@ -62,12 +69,18 @@ namespace LinBox
 		std::vector< bool >             	RadixOccupancy_;
 		const double				LOGARITHMIC_UPPER_BOUND;
 		double					totalsize;
+		// Buffered primes and their residues, BatchResidues_[i*n+j] is
+		// the j-th entry modulo the i-th prime
+		size_t					BatchSize_;
+		std::vector< Integer >			BatchPrimes_;
+		std::vector< Integer >			BatchResidues_;
 
 	public:
 		// LOGARITHMIC_UPPER_BOUND is the natural logarithm
 		// of an upper bound on the resulting integers
-		FullMultipCRA(const double b=0.0) :
-			LOGARITHMIC_UPPER_BOUND(b), totalsize(0.0)
+		// batch is the number of primes reconstructed at once (0 or 1: no buffering)
+		FullMultipCRA(const double b=0.0, const size_t batch=DEFAULT_CRA_BATCH_SIZE) :
+			LOGARITHMIC_UPPER_BOUND(b), totalsize(0.0), BatchSize_(batch)
 		{}
 
 		Integer& getModulus(Integer& m)
@@ -94,6 +107,7 @@ namespace LinBox
 			const BlasVector<Givaro::ZRing<Integer> >z(ZZ);
 			RadixResidues_.resize(1,z);
 			RadixOccupancy_.resize(1); RadixOccupancy_.front() = false;
+			BatchPrimes_.resize(0); BatchResidues_.resize(0);
 			progress( D, e);
 #if 0
 			std::vector< double >::iterator  _dsz_it = RadixSizes_.begin();
@@ -121,6 +135,7 @@ namespace LinBox
 			Givaro::ZRing<Integer> ZZ;
 			RadixResidues_.resize(1,BlasVector<Givaro::ZRing<Integer> >(ZZ));
 			RadixOccupancy_.resize(1); RadixOccupancy_.front() = false;
+			BatchPrimes_.resize(0); BatchResidues_.resize(0);
 			progress(D, e);
 		}
 
@@ -132,6 +147,7 @@ namespace LinBox
 			Givaro::ZRing<Integer> ZZ ;
 			RadixResidues_.resize(1,BlasVector<Givaro::ZRing<Integer> >(ZZ));
 			RadixOccupancy_.resize(1); RadixOccupancy_.front() = false;
+			BatchPrimes_.resize(0); BatchResidues_.resize(0);
 			progress(D, e);
 		}
 
@@ -211,18 +227,21 @@ namespace LinBox
 			BlasVector<Givaro::ZRing<Integer> > ri(e.field(),e.size());
 			LazyProduct mi; double di;
 			if (*_occ_it) {
-				typename BlasVector<Givaro::ZRing<Integer> >::const_iterator  e_it = e.begin();
-				BlasVector<Givaro::ZRing<Integer> >::iterator       ri_it = ri.begin();
-				BlasVector<Givaro::ZRing<Integer> >::const_iterator t0_it = _tab_it->begin();
 				Integer invprod; precomputeInvProd(invprod, D, _mod_it->operator()());
-				for( ; e_it != e.end(); ++e_it, ++ri_it, ++ t0_it) {
-					*ri_it =* e_it;
-					smallbigreconstruct(*ri_it,  *t0_it, invprod );
-				}
 				Integer tmp = D;
 				di = *_dsz_it + Givaro::naturallog(tmp);
 				mi.mulin(tmp);
 				mi.mulin(*_mod_it);
+				const Integer& mm = mi();
+				// entries are independent: D may be a whole batch of primes
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for if (ri.size() > 1) schedule(static)
+#endif
+				for(long j = 0; j < (long)ri.size(); ++j) {
+					ri[(size_t)j] = e[(size_t)j];
+					smallbigreconstruct(ri[(size_t)j], (*_tab_it)[(size_t)j], invprod );
+					ri[(size_t)j] %= mm;
+				}
 				*_occ_it = false;
 			}
 			else {
@@ -239,12 +258,16 @@ namespace LinBox
 			}
 			for(++_dsz_it, ++_mod_it, ++_tab_it, ++_occ_it ; _occ_it != RadixOccupancy_.end() ; ++_dsz_it, ++_mod_it, ++_tab_it, ++_occ_it) {
 				if (*_occ_it) {
-					BlasVector<Givaro::ZRing<Integer> >::iterator      ri_it = ri.begin();
-					BlasVector<Givaro::ZRing<Integer> >::const_iterator t_it= _tab_it->begin();
 					Integer invprod; precomputeInvProd(invprod, mi(), _mod_it->operator()());
-					for( ; ri_it != ri.end(); ++ri_it, ++ t_it)
-						smallbigreconstruct(*ri_it, *t_it, invprod);
 					mi.mulin(*_mod_it);
+					const Integer& mm = mi();
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for if (ri.size() > 1) schedule(static)
+#endif
+					for(long j = 0; j < (long)ri.size(); ++j) {
+						smallbigreconstruct(ri[(size_t)j], (*_tab_it)[(size_t)j], invprod);
+						ri[(size_t)j] %= mm;
+					}
 					di += *_dsz_it;
 					*_occ_it = false;
 				}
@@ -266,6 +289,10 @@ namespace LinBox
 		template<class Vect>
 		void progress (const Domain& D, const Vect& e)
 		{
+			if (BatchSize_ > 1) {
+				bufferize(D, e);
+				return;
+			}
 			// Radix shelves
 			std::vector< double >::iterator  _dsz_it = RadixSizes_.begin();
 			std::vector< LazyProduct >::iterator _mod_it = RadixPrimeProd_.begin();
@@ -356,6 +383,10 @@ namespace LinBox
 		template<class OKDomain>
 		void progress (const Domain& D, const BlasVector<OKDomain >& e)
 		{
+			if (BatchSize_ > 1) {
+				bufferize(D, e);
+				return;
+			}
 			// Radix shelves
 			std::vector< double >::iterator  _dsz_it = RadixSizes_.begin();
 			std::vector< LazyProduct >::iterator _mod_it = RadixPrimeProd_.begin();
@@ -447,6 +478,7 @@ namespace LinBox
 		template<class Vect>
 		Vect& result (Vect &d)
 		{
+			flush();
 			d.resize( (RadixResidues_.front()).size() );
 			std::vector< LazyProduct >::iterator          _mod_it = RadixPrimeProd_.begin();
 			std::vector< BlasVector< Givaro::ZRing<Integer> > >::iterator _tab_it = RadixResidues_.begin();
@@ -524,6 +556,7 @@ namespace LinBox
 		// spec for BlasVector
 		BlasVector<Givaro::ZRing<Integer> >& result (BlasVector<Givaro::ZRing<Integer> > &d)
 		{
+			flush();
 			d.resize( (RadixResidues_.front()).size() );
 			std::vector< LazyProduct >::iterator          _mod_it = RadixPrimeProd_.begin();
 			std::vector< BlasVector< Givaro::ZRing<Integer> > >::iterator _tab_it = RadixResidues_.begin();
@@ -610,13 +643,68 @@ namespace LinBox
 			std::vector< bool >::const_iterator    _occ_it = RadixOccupancy_.begin();
 			for( ; _occ_it != RadixOccupancy_.end() ; ++_mod_it, ++_occ_it)
 				if ((*_occ_it) && (_mod_it->noncoprime(i))) return true;
+			Integer g;
+			for(std::vector< Integer >::const_iterator _pr_it = BatchPrimes_.begin(); _pr_it != BatchPrimes_.end(); ++_pr_it)
+				if (gcd(g, i, *_pr_it) > 1) return true;
 			return false;
 		}
 
+		//! Reconstructs the buffered residues and puts them on the shelves
+		void flush()
+		{
+			const size_t k = BatchPrimes_.size();
+			if (k == 0) return;
+			const size_t n = BatchResidues_.size() / k;
+			Givaro::ZRing<Integer> ZZ;
+			BlasVector<Givaro::ZRing<Integer> > r(ZZ, n);
+			Integer M;
+			if (k == 1) {
+				M = BatchPrimes_.front();
+				for (size_t j = 0; j < n; ++j)
+					r[j] = BatchResidues_[j];
+			}
+			else {
+				CRAProductTree Tree(BatchPrimes_);
+				M = Tree.modulus();
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel if (n > 1)
+#endif
+				{
+					std::vector<Integer> w;
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp for schedule(static)
+#endif
+					for (long j = 0; j < (long)n; ++j)
+						Tree.reconstruct(r[(size_t)j], &BatchResidues_[(size_t)j], n, w);
+				}
+			}
+			BatchPrimes_.resize(0);
+			BatchResidues_.resize(0);
+			progress(M, r);
+		}
+
 
 
 	protected:
 
+		template<class Vect>
+		void bufferize(const Domain& D, const Vect& e)
+		{
+			Integer p; D.characteristic(p);
+			totalsize += Givaro::naturallog(p);
+			const size_t n = e.size();
+			if (BatchPrimes_.empty())
+				BatchResidues_.reserve(BatchSize_*n);
+			const size_t off = BatchResidues_.size();
+			BatchResidues_.resize(off+n);
+			typename Vect::const_iterator e_it = e.begin();
+			for (size_t j = 0; j < n; ++j, ++e_it)
+				D.convert(BatchResidues_[off+j], *e_it);
+			BatchPrimes_.push_back(p);
+			if (BatchPrimes_.size() >= BatchSize_)
+				flush();
+		}
+
 		Integer& precomputeInvProd(Integer& res, const Integer& m1, const Integer& m0)
 		{
 			inv(res, m0, m1);
@@ -33,12 +33,18 @@
 #include <stdlib.h>
 #include "linbox/vector/blas-vector.h"
 #include <givaro/givrnsfixed.h>
+#include "linbox/algorithms/rns.h"
 
 namespace LinBox
 {
 
 	/*! NO DOC...
 	 * @ingroup CRA
+	 *
+	 * When the primes allow it (see \c RNSBlasConverter), the residues
+	 * are stored as doubles, one row per prime, and all the entries are
+	 * reconstructed at once with matrix products instead of one
+	 * \c RnsToRing per entry.
 	 * @bib
 	 */
 	template<class Domain_Type>
@@ -56,6 +62,10 @@ namespace LinBox
 		integer _product;
 		integer _midprod;
 
+		RNSBlasConverter                _conv;
+		std::vector<double>             _rnsres; //!< _rnsres[i*_n+j]: j-th entry mod i-th prime
+		size_t                          _n;
+
 	public:
 		GivaroRnsFixedCRA(const std::vector<integer>& primes)
 				: Father_t(primes),
@@ -63,6 +73,7 @@ namespace LinBox
 				  iterationnumber(0)
 				  , residues(0,BlasVector<Givaro::ZRing<Integer> >(Givaro::ZRing<Integer>()))
 				  , _product(1)
+				  , _conv(primes), _n(0)
 		{
 			for(size_t i=0; i<primes.size(); ++i)
 				_product *= primes[i];
@@ -75,6 +86,7 @@ namespace LinBox
 				  iterationnumber(0)
 				  , residues(0,BlasVector<Givaro::ZRing<Integer> >(Givaro::ZRing<Integer>()))
 				  , _product(1)
+				  , _conv(primes.getRep()), _n(0)
 		{
 			for(size_t i=0; i<primes.size(); ++i)
 				_product *= primes[i];
@@ -96,15 +108,26 @@ namespace LinBox
 		template< template<class, class> class Vect, template <class> class Alloc>
 		void initialize (const Domain& D, const Vect<DomainElement, Alloc<DomainElement> >& e)
 		{
-			residues.resize(e.size());
+			clear();
+			_n = e.size();
+			if (_conv.usable())
+				_rnsres.reserve(nbloops*_n);
+			else
+				residues.resize(e.size());
 			this->progress(D,e);
 		}
 
 		void initialize (const Domain& D, const BlasVector<Domain >& e)
 		{
-			Givaro::ZRing<Integer> ZZ;
-			BlasVector<Givaro::ZRing<Integer> > Z(ZZ);
-			residues.resize(e.size(),Z);
+			clear();
+			_n = e.size();
+			if (_conv.usable())
+				_rnsres.reserve(nbloops*_n);
+			else {
+				Givaro::ZRing<Integer> ZZ;
+				BlasVector<Givaro::ZRing<Integer> > Z(ZZ);
+				residues.resize(e.size(),Z);
+			}
 			this->progress(D,e);
 		}
 
@@ -113,6 +136,10 @@ namespace LinBox
 		void progress (const Domain& D, const Vect<DomainElement, Alloc<DomainElement> >& e)
 		{
 			++iterationnumber;
+			if (_conv.usable()) {
+				bufferize(D, e);
+				return;
+			}
 			typename Vect<DomainElement, Alloc<DomainElement> >::const_iterator eit=e.begin();
 			std::vector<std::vector< Integer > >::iterator rit = residues.begin();
 
@@ -127,6 +154,10 @@ namespace LinBox
 		void progress (const Domain& D, const BlasVector<Domain>& e)
 		{
 			++iterationnumber;
+			if (_conv.usable()) {
+				bufferize(D, e);
+				return;
+			}
 			typename BlasVector<Domain >::const_iterator eit=e.begin();
 			std::vector<BlasVector< Givaro::ZRing<Integer> > >::iterator rit = residues.begin();
 
@@ -142,6 +173,11 @@ namespace LinBox
 		template<template<class, class> class Vect, template <class> class Alloc>
 		Vect<Integer, Alloc<Integer> >& result (Vect<Integer, Alloc<Integer> > &d)
 		{
+			if (_conv.usable()) {
+				d.resize(_n);
+				if (_n) _conv.convert(&d[0], 1, &_rnsres[0], _n, _n, true);
+				return d;
+			}
 			d.resize(0);
 			for(typename Vect<Integer, Alloc<Integer> >::const_iterator rit = residues.begin(); rit != residues.end(); ++rit) {
 				Integer tmp;
@@ -159,6 +195,11 @@ namespace LinBox
 
 		BlasVector<Givaro::ZRing<Integer> >& result (BlasVector<Givaro::ZRing<Integer> > &d)
 		{
+			if (_conv.usable()) {
+				d.resize(_n);
+				if (_n) _conv.convert(d.getWritePointer(), d.getStride(), &_rnsres[0], _n, _n, true);
+				return d;
+			}
 			d.resize(0);
 			for(std::vector<BlasVector< Givaro::ZRing<Integer> > >::const_iterator rit = residues.begin(); rit != residues.end(); ++rit) {
 				Integer tmp;
@@ -183,6 +224,30 @@ namespace LinBox
 			return false;
 		}
 
+	protected:
+
+		//! forgets the images of a previous reconstruction
+		void clear()
+		{
+			iterationnumber = 0;
+			_rnsres.clear();
+			residues.clear();
+		}
+
+		template<class Vect>
+		void bufferize(const Domain& D, const Vect& e)
+		{
+			linbox_check(e.size() == _n);
+			const size_t off = _rnsres.size();
+			_rnsres.resize(off+_n);
+			typename Vect::const_iterator eit=e.begin();
+			for(size_t j = 0; j < _n; ++j, ++eit) {
+				Integer tmp;
+				D.convert(tmp, *eit);
+				_rnsres[off+j] = (double)tmp;
+			}
+		}
+
 
 
 
@@ -0,0 +1,165 @@
+/* linbox/algorithms/cra-product-tree.h
+ * Copyright (C) 2026 the LinBox group
+ *
+ * ========LICENCE========
+ * This file is part of the library LinBox.
+ *
+ * LinBox is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ */
+
+/*!@file algorithms/cra-product-tree.h
+ * @ingroup algorithms
+ * @brief Subproduct tree Chinese remaindering of many residues at once.
+ */
+
+#ifndef __LINBOX_cra_product_tree_H
+#define __LINBOX_cra_product_tree_H
+
+#include <vector>
+#include <utility>
+
+#include "linbox/integer.h"
+#include "linbox/util/debug.h"
+
+namespace LinBox
+{
+
+	/*! @brief Subproduct tree over a batch of coprime moduli.
+	 * @ingroup CRA
+	 *
+	 * The tree of the products of the moduli \f$m_0,\dots,m_{k-1}\f$ and
+	 * the CRT constants \f$c_i = (M/m_i)^{-1} \bmod m_i\f$ are computed once
+	 * (the latter with a remainder tree of \f$M\f$ modulo the \f$m_i^2\f$);
+	 * they are then shared by all the entries to reconstruct. Each entry is
+	 * \f$\sum_i (r_i c_i \bmod m_i) M/m_i\f$, summed up the tree, i.e. with
+	 * balanced products only and one final reduction modulo \f$M\f$.
+	 *
+	 * \c reconstruct is \c const and only needs a per-thread workspace, so
+	 * entries can be reconstructed in parallel.
+	 */
+	struct CRAProductTree {
+
+		CRAProductTree() {}
+
+		template<class Vect>
+		CRAProductTree(const Vect& moduli)
+		{
+			build(moduli);
+		}
+
+		//! (re)builds the tree over \p moduli, which must be pairwise coprime
+		template<class Vect>
+		void build(const Vect& moduli)
+		{
+			_tree.resize(1);
+			_tree.front().assign(moduli.begin(), moduli.end());
+			linbox_check(_tree.front().size() > 0);
+
+			// Products, bottom-up. An odd node is carried to the level above.
+			while (_tree.back().size() > 1) {
+				const size_t k = _tree.back().size();
+				std::vector<Integer> above((k+1)/2);
+				const std::vector<Integer>& below = _tree.back();
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for if (k > 16) schedule(dynamic)
+#endif
+				for (long i = 0; i < (long)(k/2); ++i)
+					Integer::mul(above[(size_t)i], below[2*(size_t)i], below[2*(size_t)i+1]);
+				if (k & 1)
+					above.back() = below.back();
+				_tree.push_back(std::move(above));
+			}
+
+			// Remainders M mod T^2, top-down: M mod m_i^2 = m_i ((M/m_i) mod m_i)
+			std::vector<Integer> rem(1, modulus()), sub;
+			for (size_t h = _tree.size()-1; h-- > 0; ) {
+				const std::vector<Integer>& T = _tree[h];
+				sub.resize(T.size());
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for if (T.size() > 16) schedule(dynamic)
+#endif
+				for (long i = 0; i < (long)T.size(); ++i) {
+					Integer sq; Integer::mul(sq, T[(size_t)i], T[(size_t)i]);
+					Integer::mod(sub[(size_t)i], rem[(size_t)i/2], sq);
+				}
+				std::swap(rem, sub);
+			}
+
+			const std::vector<Integer>& m = _tree.front();
+			_crt.resize(m.size());
+			for (size_t i = 0; i < m.size(); ++i) {
+				Integer q; Integer::div(q, rem[i], m[i]);
+				inv(_crt[i], q, m[i]);
+			}
+		}
+
+		//! number of moduli
+		size_t size() const { return _tree.front().size(); }
+
+		//! product of all the moduli
+		const Integer& modulus() const { return _tree.back().front(); }
+
+		const std::vector<Integer>& moduli() const { return _tree.front(); }
+
+		/** x = r[i*stride] mod m_i for all i, and 0 <= x < M.
+		 * @param w workspace, reused between calls (one per thread).
+		 */
+		Integer& reconstruct(Integer& x, const Integer* r, size_t stride, std::vector<Integer>& w) const
+		{
+			const std::vector<Integer>& m = _tree.front();
+			size_t k = m.size();
+			w.resize(k);
+			for (size_t i = 0; i < k; ++i) {
+				Integer::mul(w[i], r[i*stride], _crt[i]);
+				Integer::modin(w[i], m[i]);
+			}
+
+			// w[i] <- w[2i] T[2i+1] + w[2i+1] T[2i], in place
+			Integer t;
+			for (size_t h = 0; k > 1; ++h) {
+				const std::vector<Integer>& T = _tree[h];
+				for (size_t i = 0; i+1 < k; i += 2) {
+					Integer::mulin(w[i], T[i+1]);
+					Integer::mul(t, w[i+1], T[i]);
+					Integer::addin(w[i], t);
+					std::swap(w[i/2], w[i]);
+				}
+				if (k & 1)
+					std::swap(w[k/2], w[k-1]);
+				k = (k+1)/2;
+			}
+
+			Integer::mod(x, w.front(), modulus());
+			if (x < 0) x += modulus();
+			return x;
+		}
+
+	protected:
+		std::vector< std::vector<Integer> > _tree; //!< _tree[0]: moduli, _tree.back(): their product
+		std::vector< Integer >              _crt;  //!< (M/m_i)^{-1} mod m_i
+	};
+
+}
+
+#endif //__LINBOX_cra_product_tree_H
+
+// Local Variables:
+// mode: C++
+// tab-width: 4
+// indent-tabs-mode: nil
+// c-basic-offset: 4
+// End:
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
@@ -95,6 +95,41 @@ namespace LinBox
 			BlasMatrix<typename DenseMat::Field> & Ker,
 			size_t & kerdim);
 
+	/*! Nullspace of a dense matrix on a finite field, multithreaded.
+	 * Same as \c NullSpaceBasisIn, but the basis is built from a \c PLUQ
+	 * decomposition of \p A, computed by FFPACK's task parallel PLUQ;
+	 * the fills, the triangular solves and the permutation are then
+	 * done by tiles, in parallel. A is modified.
+	 */
+	template<class Field>
+	size_t&
+	NullSpaceBasisParallelIn (const LINBOX_enum(Tag::Side) Side,
+				  BlasMatrix<Field> & A,
+				  BlasMatrix<Field> & Ker,
+				  size_t & kerdim) ;
+
+	template<class DenseMat>
+	size_t&
+	NullSpaceBasisParallelIn (const LINBOX_enum(Tag::Side) Side,
+				  BlasSubmatrix<DenseMat> & A,
+				  BlasMatrix<typename DenseMat::Field> & Ker,
+				  size_t & kerdim) ;
+
+	//! Same as \c NullSpaceBasisParallelIn, A is preserved.
+	template<class Field>
+	size_t&
+	NullSpaceBasisParallel (const LINBOX_enum(Tag::Side) Side,
+				const BlasMatrix<Field> & A,
+				BlasMatrix<Field> & Ker,
+				size_t & kerdim) ;
+
+	template<class DenseMat>
+	size_t&
+	NullSpaceBasisParallel (const LINBOX_enum(Tag::Side) Side,
+				const BlasSubmatrix<DenseMat> & A,
+				BlasMatrix<typename DenseMat::Field> & Ker,
+				size_t & kerdim);
+
 
 
 } // LinBox
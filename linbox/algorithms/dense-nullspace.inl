@@ -33,6 +33,12 @@
 #include <fflas-ffpack/utils/Matio.h> // write_field ;
 #include <iostream>
 #include <cassert>
+#include <vector>
+
+#ifdef __LINBOX_USE_OPENMP
+#include <omp.h>
+#include "fflas-ffpack/paladin/parallel.h" // PAR_BLOCK
+#endif
 
 namespace LinBox
 {
@@ -342,6 +348,141 @@ namespace LinBox
 			delete[] Q ;
 			return V;
 		}
+
+		/*! @name Tiled kernels
+		 * Each splits the dimension along which the work is independent
+		 * in tiles of \c NullSpaceTile rows or columns, processed by
+		 * different threads.
+		 */
+		//@{
+		static const size_t NullSpaceTile = 256 ;
+
+		//! \c FFPACK::applyP, by tiles of the \p M rows (\p Side right) or columns (left) of \p A
+		template<class Field>
+		void parApplyP(const Field & F, const FFLAS::FFLAS_SIDE Side, const FFLAS::FFLAS_TRANSPOSE Trans,
+			       const size_t M, const size_t ibeg, const size_t iend,
+			       typename Field::Element * A, const size_t lda, const size_t * P)
+		{
+			const long nt = (long)((M + NullSpaceTile - 1) / NullSpaceTile) ;
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for schedule(dynamic) if (nt > 1)
+#endif
+			for (long t = 0 ; t < nt ; ++t) {
+				const size_t k0 = (size_t)t*NullSpaceTile, k = std::min(NullSpaceTile, M-k0) ;
+				typename Field::Element * At = (Side == FFLAS::FflasRight) ? A + k0*lda : A + k0 ;
+				FFPACK::applyP(F, Side, Trans, k, ibeg, iend, At, lda, P);
+			}
+		}
+
+		/*! \c FFLAS::ftrsm with \p T of order \p R, by tiles of the \p K
+		 * columns (\p Side left) or rows (right) of \p B.
+		 */
+		template<class Field>
+		void parTrsm(const Field & F, const FFLAS::FFLAS_SIDE Side, const FFLAS::FFLAS_UPLO Uplo,
+			     const FFLAS::FFLAS_DIAG Diag, const size_t R, const size_t K,
+			     const typename Field::Element * T, const size_t ldt,
+			     typename Field::Element * B, const size_t ldb)
+		{
+			const long nt = (long)((K + NullSpaceTile - 1) / NullSpaceTile) ;
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for schedule(dynamic) if (nt > 1)
+#endif
+			for (long t = 0 ; t < nt ; ++t) {
+				const size_t k0 = (size_t)t*NullSpaceTile, k = std::min(NullSpaceTile, K-k0) ;
+				if (Side == FFLAS::FflasLeft)
+					FFLAS::ftrsm(F, Side, Uplo, FFLAS::FflasNoTrans, Diag, R, k, F.one, T, ldt, B + k0, ldb);
+				else
+					FFLAS::ftrsm(F, Side, Uplo, FFLAS::FflasNoTrans, Diag, k, R, F.one, T, ldt, B + k0*ldb, ldb);
+			}
+		}
+		//@}
+
+		/*! \c FFPACK::PLUQ of \p A, on all the threads with OpenMP.
+		 * The recursive PLUQ then runs its blocks as tasks; it reveals
+		 * the same rank profiles as the sequential one.
+		 * @return the rank of \p A
+		 */
+		template<class Field>
+		size_t parPLUQ(const Field & F, const size_t M, const size_t N,
+			       typename Field::Element * A, const size_t lda,
+			       size_t * P, size_t * Q)
+		{
+			if (!M || !N)
+				return 0;
+#ifdef __LINBOX_USE_OPENMP
+			const int nt = omp_get_max_threads();
+			if (nt > 1) {
+				size_t R = 0;
+				FFLAS::ParSeqHelper::Parallel<FFLAS::CuttingStrategy::Recursive,
+							      FFLAS::StrategyParameter::Threads> PSH(nt);
+				PAR_BLOCK {
+					R = FFPACK::PLUQ(F, FFLAS::FflasNonUnit, M, N, A, lda, P, Q, PSH);
+				}
+				return R;
+			}
+#endif
+			return FFPACK::PLUQ(F, FFLAS::FflasNonUnit, M, N, A, lda, P, Q);
+		}
+
+		/*! Right or left nullspace from a \c PLUQ decomposition of rank \p R.
+		 * With \f$A = PLUQ\f$ and \f$U = [U_1\ U_2]\f$, the right nullspace
+		 * is spanned by \f$Q^T [-U_1^{-1}U_2;\ I]\f$; with
+		 * \f$L = [L_1;\ L_2]\f$, the left one by \f$[-L_2L_1^{-1}\ I] P^T\f$.
+		 * Fills, triangular solves and the permutation are done by tiles.
+		 * @param A the factors, \f$M \times N\f$
+		 * @param Ker result, \f$N \times (N-R)\f$ or \f$(M-R) \times M\f$
+		 */
+		template<class Field>
+		size_t NullSpaceFromPLUQ(const Field & F, const LINBOX_enum(Tag::Side) Side,
+					 const size_t M, const size_t N, const size_t R,
+					 const typename Field::Element * A, const size_t lda,
+					 const size_t * P, const size_t * Q,
+					 typename Field::Element * Ker, const size_t ldk)
+		{
+			if (Side == Tag::Side::Right) {
+				const size_t kerdim = N - R ;
+				// [-U_2 ; I]
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+				for (long ii = 0 ; ii < (long)N ; ++ii) {
+					const size_t i = (size_t)ii ;
+					typename Field::Element * Ki = Ker + i*ldk ;
+					if (i < R)
+						for (size_t j = 0 ; j < kerdim ; ++j)
+							F.neg(Ki[j], A[i*lda+R+j]);
+					else
+						for (size_t j = 0 ; j < kerdim ; ++j)
+							Ki[j] = (j == i-R) ? F.one : F.zero ;
+				}
+				if (R)
+					parTrsm(F, FFLAS::FflasLeft, FFLAS::FflasUpper, FFLAS::FflasNonUnit,
+						R, kerdim, A, lda, Ker, ldk);
+				parApplyP(F, FFLAS::FflasLeft, FFLAS::FflasTrans, kerdim, 0, N, Ker, ldk, Q);
+				return kerdim ;
+			}
+			else {
+				const size_t kerdim = M - R ;
+				// [-L_2 I]
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+				for (long ii = 0 ; ii < (long)kerdim ; ++ii) {
+					const size_t i = (size_t)ii ;
+					typename Field::Element * Ki = Ker + i*ldk ;
+					for (size_t j = 0 ; j < R ; ++j)
+						F.neg(Ki[j], A[(R+i)*lda+j]);
+					for (size_t j = R ; j < M ; ++j)
+						Ki[j] = (j == R+i) ? F.one : F.zero ;
+				}
+				if (R)
+					parTrsm(F, FFLAS::FflasRight, FFLAS::FflasLower, FFLAS::FflasUnit,
+						R, kerdim, A, lda, Ker, ldk);
+				parApplyP(F, FFLAS::FflasRight, FFLAS::FflasNoTrans, kerdim, 0, M, Ker, ldk, P);
+				return kerdim ;
+			}
+		}
+
 	} // Protected
 
 		/** Computes the kernel of a dense matrix using \c LQUP.
@@ -437,6 +578,68 @@ namespace LinBox
 		return NullSpaceBasisIn(Side,Asub,Ker,kerdim);
 	}
 
+	template<class DenseMat>
+	size_t&
+	NullSpaceBasisParallelIn (const LINBOX_enum(Tag::Side) Side,
+				  BlasSubmatrix<DenseMat> & A,
+				  BlasMatrix<typename DenseMat::Field> & Ker,
+				  size_t & kerdim)
+	{
+		typedef typename DenseMat::Field Field;
+		const Field & F = A.field();
+		const size_t M = A.rowdim(), N = A.coldim();
+
+		std::vector<size_t> P(std::max(M,(size_t)1)), Q(std::max(N,(size_t)1));
+		for (size_t i = 0 ; i < P.size() ; ++i) P[i] = i ;
+		for (size_t j = 0 ; j < Q.size() ; ++j) Q[j] = j ;
+		const size_t R = Protected::parPLUQ(F, M, N, A.getWritePointer(), A.getStride(), &P[0], &Q[0]);
+
+		if (Side == Tag::Side::Right)
+			Ker.resize(N, N-R);
+		else
+			Ker.resize(M-R, M);
+		if (!Ker.rowdim() || !Ker.coldim()) {
+			kerdim = 0;
+			return kerdim;
+		}
+		kerdim = Protected::NullSpaceFromPLUQ(F, Side, M, N, R, A.getPointer(), A.getStride(),
+						      &P[0], &Q[0], Ker.getWritePointer(), Ker.getStride());
+		return kerdim;
+	}
+
+	template<class Field>
+	size_t&
+	NullSpaceBasisParallelIn (const LINBOX_enum(Tag::Side) Side,
+				  BlasMatrix<Field> & A,
+				  BlasMatrix<Field> & Ker,
+				  size_t & kerdim)
+	{
+		BlasSubmatrix< BlasMatrix<Field>  > Asub(A);
+		return NullSpaceBasisParallelIn(Side,Asub,Ker,kerdim);
+	}
+
+	template<class Field>
+	size_t&
+	NullSpaceBasisParallel (const LINBOX_enum(Tag::Side) Side,
+				const BlasMatrix<Field> & A,
+				BlasMatrix<Field> & Ker,
+				size_t & kerdim)
+	{
+		BlasMatrix<Field> B (A);
+		return NullSpaceBasisParallelIn(Side,B,Ker,kerdim);
+	}
+
+	template<class DenseMat>
+	size_t&
+	NullSpaceBasisParallel (const LINBOX_enum(Tag::Side) Side,
+				const BlasSubmatrix<DenseMat> & A,
+				BlasMatrix<typename DenseMat::Field> & Ker,
+				size_t & kerdim)
+	{
+		BlasMatrix<typename DenseMat::Field> B (A);
+		return NullSpaceBasisParallelIn<typename DenseMat::Field>(Side,B,Ker,kerdim);
+	}
+
 	template<class Field>
 	size_t&
 	NullSpaceBasis (const LINBOX_enum(Tag::Side) Side,
@@ -175,7 +175,7 @@ namespace LinBox
 		Integer M = 1;
 
 		//BlasMatrixBase<Quotient> ABase(A);
-		RationalMatrixFactory<Givaro::IntegerDom,Rationals, BlasMatrix<Rationals > > FA(&A);
+		StreamingRationalMatrixFactory<Rationals> FA(A);
 		Integer di=1;
 
 		for (int i=(int)A.rowdim()-1; i >= 0 ; --i) {
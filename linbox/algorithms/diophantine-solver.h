@@ -44,6 +44,9 @@ namespace LinBox
 	 *       Method diophantineSolve creates a solution with minimal denominator, and can also create
 	 *       a certificate of minimality (described in 'Certified Dense Linear System Solving' by Mulders+Storjohann)
 	 *       which will be left in the public field lastCertificate.
+	 *       With OpenMP, diophantineSolve runs its randomized rational solves
+	 *       concurrently, one per thread, against the factorization of A of its first solve
+	 *       (see RationalSolver::randomCombinationSolve).
 	 */
 	template<class QSolver>
 	class DiophantineSolver {
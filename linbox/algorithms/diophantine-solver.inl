@@ -34,6 +34,12 @@
 
 #include "linbox/linbox-config.h"
 
+#include <random>
+#include <vector>
+#ifdef __LINBOX_USE_OPENMP
+#include <omp.h>
+#endif
+
 //#define DEBUG_DIO
 //#define INFO_DIO
 
@@ -111,63 +117,97 @@ namespace LinBox
 		numFailedCallsToSolver = 0;
 		numRevelantSolutions=1;
 		int boredom = 0; //used in monte carlo, when we assume there's a diophantine solution
-		while (! _ring.areEqual(upperDenBound, lowerDenBound)) {
-			_rationalSolver.chooseNewPrime();
-			status = _rationalSolver.monolithicSolve(x, den, A, b, (level >= SL_LASVEGAS), true, 1, level);
-			numSolutionsNeeded++;
+		bool done = _ring.areEqual(upperDenBound, lowerDenBound);
+#ifdef __LINBOX_USE_OPENMP
+		const int nthreads = omp_get_max_threads();
+#else
+		const int nthreads = 1;
+#endif
+		// A was factored modulo a prime by the first solve: the retries
+		// only draw new random combinations against it, each thread with
+		// its own random generator.
+		std::vector<std::mt19937_64> generators;
+		generators.reserve((size_t)nthreads);
+		std::mt19937_64 seeder((uint64_t)BaseTimer::seed());
+		for (int t = 0; t < nthreads; ++t)
+			generators.push_back(std::mt19937_64(seeder()));
+
+		while (!done) {
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for schedule(dynamic,1) num_threads(nthreads)
+#endif
+			for (int t = 0; t < nthreads; ++t) {
+				bool skip;
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp critical(diophantine_combine)
+#endif
+				skip = done;
+				if (skip)
+					continue;
+
+				Vector1 xt(x);
+				Integer dent, zbNumer, certifiedDenFactor;
+				VectorFraction<Ring> cert(_ring, 0);
+				SolverReturnStatus st = _rationalSolver.randomCombinationSolve(xt, dent, cert, zbNumer, certifiedDenFactor,
+											       A, b, (level >= SL_LASVEGAS),
+											       generators[(size_t)t], level);
+
+				// the solutions are combined one at a time, in completion order
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp critical(diophantine_combine)
+#endif
+				if (!done) {
+					numSolutionsNeeded++;
 #ifdef DEBUG_DIO
-			std::cout << '.' ;
+					std::cout << '.' ;
 #endif
-			if (status != SS_OK) {
-				numFailedCallsToSolver++;
-				continue;
-			}
-			VectorFraction<Ring> yhat(_ring, x.size());
-			yhat. numer = x;
-			yhat. denom = den;
-			// goodCombination first represents whether a decrease in upperDenBound is achieved
-			bool goodCombination = y.boundedCombineSolution(yhat, ODB, upperDenBound);
-
-			if (goodCombination) {
-				numRevelantSolutions++;
+					if (st != SS_OK)
+						numFailedCallsToSolver++;
+					else {
+						VectorFraction<Ring> yhat(_ring, xt.size());
+						yhat. numer = xt;
+						yhat. denom = dent;
+						// goodCombination first represents whether a decrease in upperDenBound is achieved
+						bool goodCombination = y.boundedCombineSolution(yhat, ODB, upperDenBound);
+
+						if (goodCombination) {
+							numRevelantSolutions++;
 #ifdef DEBUG_DIO
-				std::cout << "new gcd(denom, y0.denom): " << upperDenBound << std::endl;
+							std::cout << "new gcd(denom, y0.denom): " << upperDenBound << std::endl;
 #endif
-			}
-			// now, goodCombination will be updated as to whether there is an increase in lowerDenBound
-			if (level == SL_MONTECARLO) {
-				if (goodCombination)
-					boredom = 0;
-				else
-					boredom++;
-				if (boredom > MONTE_CARLO_BOREDOM)
-					break; //exit while loop
-				goodCombination = false;          //since we dont update lowerDenBound, no increase happens
-			}
-			else if (level == SL_LASVEGAS) {
+						}
+						// now, goodCombination will be updated as to whether there is an increase in lowerDenBound
+						if (level == SL_MONTECARLO) {
+							if (goodCombination)
+								boredom = 0;
+							else
+								boredom++;
+							if (boredom > MONTE_CARLO_BOREDOM)
+								done = true;
+							goodCombination = false;          //since we dont update lowerDenBound, no increase happens
+						}
+						else if (level == SL_LASVEGAS) {
 #ifdef DEBUG_DIO
-				goodCombination =
-				!_ring.isDivisor(lowerDenBound, _rationalSolver.lastCertifiedDenFactor);
+							goodCombination =
+							!_ring.isDivisor(lowerDenBound, certifiedDenFactor);
 #endif
-				_ring.lcmin(lowerDenBound, _rationalSolver.lastCertifiedDenFactor);
-			}
-			else { //level == SL_CERTIFIED
-
-				// 				paranoid check
-				// 				if (_ring.isZero(_rationalSolver.lastCertifiedDenFactor)) {
-				// 					std::cout << "ERROR: got a 0 den factor" << std::endl;
-				// 					return SS_FAILED;
-				// 				}
-
-				goodCombination = lastCertificate.combineCertificate
-				(_rationalSolver.lastCertificate, n1, lowerDenBound,
-				 _rationalSolver.lastZBNumer,
-				 _rationalSolver.lastCertifiedDenFactor);
-			}
+							_ring.lcmin(lowerDenBound, certifiedDenFactor);
+						}
+						else { //level == SL_CERTIFIED
+							goodCombination = lastCertificate.combineCertificate
+							(cert, n1, lowerDenBound,
+							 zbNumer,
+							 certifiedDenFactor);
+						}
 #ifdef DEBUG_DIO
-			if (goodCombination)
-				std::cout << "new certified denom factor: " << lowerDenBound << std::endl;
+						if (goodCombination)
+							std::cout << "new certified denom factor: " << lowerDenBound << std::endl;
 #endif
+						if (_ring.areEqual(upperDenBound, lowerDenBound))
+							done = true;
+					}
+				}
+			}
 		}
 #ifdef INFO_DIO
 		std::cout << "number of solutions needed in total: " << numSolutionsNeeded << std::endl;
@@ -36,6 +36,13 @@
 #include "linbox/solutions/solve.h"
 #include "linbox/solutions/methods.h"
 
+#include <map>
+#include <set>
+#include <utility>
+#ifdef __LINBOX_USE_OPENMP
+#include <omp.h>
+#endif
+
 namespace LinBox
 {
 
@@ -94,17 +101,23 @@ namespace LinBox
 		delete[] Qt;
 	}
 
+	// Images of d1 and d2 (not divided by s1, s2), indexed by the prime
+	typedef std::map<integer, std::pair<integer, integer> > DoubleDetImages;
+
 	// Iteration class for the Chinese remaindering phase
+	// Images already computed are taken from _images when given.
 	template <class BlackBox>
 	struct IntegerDoubleDetIteration{
 
 		const BlackBox& _matA;
 		const typename BlackBox::Field::Element _s1;
 		const typename BlackBox::Field::Element _s2;
+		const DoubleDetImages* _images;
 		IntegerDoubleDetIteration(const BlackBox& A,
 					  const typename BlackBox::Field::Element& s1,
-					  const typename BlackBox::Field::Element& s2) :
-			_matA(A), _s1(s1), _s2(s2)
+					  const typename BlackBox::Field::Element& s2,
+					  const DoubleDetImages* images = NULL) :
+			_matA(A), _s1(s1), _s2(s2), _images(images)
 		{}
 
 		template<class Field>
@@ -118,6 +131,17 @@ namespace LinBox
 			dd.resize(2);
 			F.init(s1p, _s1);
 			F.init(s2p, _s2);
+			if (_images) {
+				integer p; F.characteristic(p);
+				DoubleDetImages::const_iterator it = _images->find(p);
+				if (it != _images->end()) {
+					F.init(dd[0], it->second.first);
+					F.init(dd[1], it->second.second);
+					F.divin (dd[0], s1p);
+					F.divin (dd[1], s2p);
+					return dd;
+				}
+			}
 			FBlackbox Ap(_matA, F);
 			const size_t N = _matA.coldim();
 			//Timer tim;
@@ -136,6 +160,36 @@ namespace LinBox
 		}
 	};
 
+	/* Prime iterator going through the primes of some images first,
+	 * then through the primes of another iterator.
+	 */
+	template <class PrimeIter>
+	struct ImagesPrimeIterator {
+		typedef typename PrimeIter::Prime_Type Prime_Type;
+		typedef typename PrimeIter::UniqueSamplingTag UniqueSamplingTag;
+		typedef typename PrimeIter::IteratorTag IteratorTag;
+
+		ImagesPrimeIterator(const DoubleDetImages& images, PrimeIter& next) :
+			_it(images.begin()), _end(images.end()), _next(next)
+		{}
+
+		ImagesPrimeIterator& operator++ ()
+		{
+			if (_it != _end) ++_it;
+			else ++_next;
+			return *this;
+		}
+
+		const Prime_Type& operator* () const
+		{
+			return (_it != _end) ? _it->first : *_next;
+		}
+
+	protected:
+		DoubleDetImages::const_iterator _it, _end;
+		PrimeIter&                      _next;
+	};
+
 	/* Computes the actual Hadamard bound of the matrix A by taking the minimum
 	 * of the column-wise and the row-wise euclidean norm.
 	 *
@@ -227,6 +281,7 @@ namespace LinBox
 	 * compute d1 and d2.
 	 * Assumes d1 and d2 are non zero.
 	 * Result is probablistic if proof=true
+	 * The images of d1 and d2 given in images, if any, are used first.
 	 */
 	template <class BlackBox>
 	void doubleDetGivenDivisors (const BlackBox& A,
@@ -234,14 +289,17 @@ namespace LinBox
 				     typename BlackBox::Field::Element& d2,
 				     const typename BlackBox::Field::Element& s1,
 				     const typename BlackBox::Field::Element& s2,
-				     const bool proof)
+				     const bool proof,
+				     const DoubleDetImages* images = NULL)
 	{
 
 		typename BlackBox::Field F = A.field();
-		IntegerDoubleDetIteration<BlackBox> iteration(A, s1, s2);
+		IntegerDoubleDetIteration<BlackBox> iteration(A, s1, s2, images);
 		// 0.7213475205 is an upper approximation of 1/(2log(2))
                 typedef Givaro::ModularBalanced<double> Field;
-                PrimeIterator<IteratorCategories::HeuristicTag> genprime(FieldTraits<Field>::bestBitSize(A.coldim()));
+                PrimeIterator<IteratorCategories::HeuristicTag> nextprime(FieldTraits<Field>::bestBitSize(A.coldim()));
+		const DoubleDetImages noimages;
+		ImagesPrimeIterator<PrimeIterator<IteratorCategories::HeuristicTag> > genprime(images ? *images : noimages, nextprime);
 
 		BlasVector<typename BlackBox::Field> dd(A.field());
 		if (proof) {
@@ -307,6 +365,60 @@ namespace LinBox
 		BlasVector<typename BlackBox::Field> c(A.field(),N);
 		for (size_t i=0; i<N; ++i)
 			c[i] = A.getEntry (N, i);
+
+#ifdef __LINBOX_USE_OPENMP
+		// While one thread solves, the others compute images of d1 and d2,
+		// which are divided by den1 and den2 in the CRA afterwards.
+		const size_t nthreads = (size_t) omp_get_max_threads();
+		if (nthreads > 1) {
+			typedef Givaro::ModularBalanced<double> Field;
+			DoubleDetImages images;
+			std::set<integer> used;
+			PrimeIterator<IteratorCategories::HeuristicTag> genprime(FieldTraits<Field>::bestBitSize(N));
+			bool solved = false;
+#pragma omp parallel
+#pragma omp single
+			{
+#pragma omp task shared(x1, den1, B, c, solved)
+				{
+					solve (x1, den1, B, c);
+#pragma omp critical(doubleDet)
+					solved = true;
+				}
+				for (size_t t = 0; t < nthreads-1; ++t) {
+#pragma omp task shared(A, images, used, genprime, solved)
+					{
+						const typename BlackBox::Field::Element one(1);
+						IntegerDoubleDetIteration<BlackBox> undivided(A, one, one);
+						bool cont = true;
+						while (cont) {
+							integer p;
+#pragma omp critical(doubleDet)
+							{
+								do { ++genprime; } while (used.count(*genprime));
+								p = *genprime;
+								used.insert(p);
+								cont = !solved;
+							}
+							if (!cont) break;
+							Field Fp(p);
+							BlasVector<Field> dd(Fp);
+							undivided(dd, Fp);
+							integer i1, i2;
+							Fp.convert(i1, dd[0]);
+							Fp.convert(i2, dd[1]);
+#pragma omp critical(doubleDet)
+							images[p] = std::make_pair(i1, i2);
+						}
+					}
+				}
+#pragma omp taskwait
+			}
+			den2 = -x1[N-1];
+			doubleDetGivenDivisors (A, d1, d2, den1, den2, proof, &images);
+			return;
+		}
+#endif
 		//Timer tim;
 		//tim.clear();
 		//tim.start();
@@ -35,6 +35,10 @@
 
 #include "linbox/matrix/matrix-domain.h"
 #include "linbox/matrix/factorized-matrix.h"
+#include "linbox/algorithms/dense-nullspace.h"
+
+#include <vector>
+#include <algorithm>
 
 namespace LinBox
 {
@@ -114,6 +118,69 @@ namespace LinBox
 		}
 
 
+		/*! row reduced echelon form (using copy), multithreaded.
+		 * The rows of the echelon form are \f$[I\ U_1^{-1}U_2]\,Q\f$ for
+		 * \f$A = PLUQ\f$, sorted by their pivot column: \c FFPACK::PLUQ
+		 * reveals the column rank profile, so this is the reduced echelon
+		 * form. The factorization is FFPACK's task parallel PLUQ; the
+		 * copy, the triangular solve and the permutation are done by
+		 * tiles, in parallel.
+		 * @warning E is supposed to be the zero matrix
+		 */
+		template<class Matrix>
+		int rowReducedEchelonParallel(Matrix &E, const Matrix& A)
+		{
+			const size_t m = A.rowdim(), n = A.coldim();
+			if (!m || !n)
+				return 0;
+
+			BlasMatrix<Field> B(field(), m, n);
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+			for (long i = 0 ; i < (long)m ; ++i)
+				for (size_t j = 0 ; j < n ; ++j)
+					B.setEntry((size_t)i, j, A.getEntry((size_t)i, j));
+
+			std::vector<size_t> P(m), Q(n);
+			const size_t ldb = B.getStride();
+			Element * b = B.getWritePointer();
+			const size_t rank = Protected::parPLUQ(field(), m, n, b, ldb, &P[0], &Q[0]);
+			if (!rank)
+				return 0;
+
+			// [I X] with X = U_1^{-1} U_2, then [I X] Q
+			Protected::parTrsm(field(), FFLAS::FflasLeft, FFLAS::FflasUpper, FFLAS::FflasNonUnit,
+					   rank, n-rank, b, ldb, b+rank, ldb);
+			for (size_t i = 0 ; i < rank ; ++i)
+				for (size_t j = 0 ; j < rank ; ++j)
+					field().assign(b[i*ldb+j], (i == j) ? field().one : field().zero);
+			Protected::parApplyP(field(), FFLAS::FflasRight, FFLAS::FflasNoTrans, rank, 0, n, b, ldb, &Q[0]);
+
+			// pivot column of each row, the same permutation on indices
+			std::vector<size_t> col(n), pivot(rank), order(rank);
+			for (size_t j = 0 ; j < n ; ++j)
+				col[j] = j;
+			for (size_t k = n ; k-- > 0 ; )
+				std::swap(col[k], col[Q[k]]);
+			for (size_t j = 0 ; j < n ; ++j)
+				if (col[j] < rank)
+					pivot[col[j]] = j;
+			for (size_t i = 0 ; i < rank ; ++i)
+				order[i] = i;
+			std::sort(order.begin(), order.end(),
+				  [&pivot](size_t a, size_t c) { return pivot[a] < pivot[c]; });
+
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+			for (long i = 0 ; i < (long)rank ; ++i)
+				for (size_t j = 0 ; j < n ; ++j)
+					E.setEntry((size_t)i, j, b[order[(size_t)i]*ldb+j]);
+			return (int)rank;
+		}
+
+
 		//!  column echelon form (using copy)
 		template<class Matrix>
 		int columnEchelon(Matrix &E, const Matrix& A)
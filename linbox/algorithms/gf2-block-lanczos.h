@@ -0,0 +1,208 @@
+/* linbox/algorithms/gf2-block-lanczos.h
+ * Copyright (C) 2026 the LinBox group
+ *
+ * ========LICENCE========
+ * This file is part of the library LinBox.
+ *
+ * LinBox is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ */
+
+/*! @file algorithms/gf2-block-lanczos.h
+ * @ingroup algorithms
+ * @brief Montgomery's block Lanczos over GF(2), on 64-bit words.
+ */
+
+#ifndef __LINBOX_gf2_block_lanczos_H
+#define __LINBOX_gf2_block_lanczos_H
+
+#include "linbox/linbox-config.h"
+
+#include <vector>
+#include <string>
+#include <random>
+
+#include "linbox/field/gf2.h"
+#include "linbox/solutions/methods.h"
+
+namespace LinBox
+{
+
+	/** \brief Block Lanczos iteration over GF(2), with 64 vectors to a word.
+	 *
+	 * This is the iteration of @ref MGBlockLanczosSolver with the blocking
+	 * factor fixed to 64: an \f$n\times 64\f$ block is a vector of \f$n\f$
+	 * words and a \f$64\times 64\f$ matrix an array of 64 words, one per
+	 * row. Additions are XORs and the products by a \f$64\times 64\f$
+	 * matrix are byte-indexed table lookups.
+	 *
+	 * The matrix \f$B\f$ is always symmetrized: the iteration runs on
+	 * \f$A = B^T B\f$, applied to a whole block at once from a compressed
+	 * row and a compressed column copy of \f$B\f$. With OpenMP, these
+	 * products are split by rows, and the inner products \f$V^T W\f$ by
+	 * row chunks, whose partial products are summed.
+	 *
+	 * If the traits name a \c checkpointFile, the state of the iteration
+	 * is written there every \c checkpointInterval iterations, and a later
+	 * call on the same matrix resumes from it instead of starting over.
+	 * The file is removed when the computation ends. \c stopAfter() ends
+	 * a run at a checkpoint, for instance to fit a time limit.
+	 *
+	 * \c solve(x, A, b, Method::BlockLanczos()) uses this solver when
+	 * \p A is a @ref ZeroOne<GF2>.
+	 *
+	 * The \p Blackbox is a sparse matrix over GF(2) whose rows \c A[i]
+	 * list the column indices of their nonzero entries, as
+	 * @ref ZeroOne<GF2>.
+	 */
+	class GF2BlockLanczosSolver {
+	public:
+
+		typedef uint64_t Word;
+
+		/** Constructor
+		 * @param F GF(2)
+		 * @param traits @ref BlockLanczosTraits; the blocking factor and
+		 *               the preconditioner are ignored
+		 * @param seed Seed of the random blocks, \c 0 for a random seed
+		 */
+		GF2BlockLanczosSolver (const GF2 &F, const BlockLanczosTraits &traits, uint64_t seed = 0);
+
+		/** Solve the linear system Ax = b.
+		 *
+		 * Computes a solution of \f$A^T A x = A^T b\f$, corrects it
+		 * with the kernel vectors of \f$A^T A\f$ found along, and returns
+		 * it if it is a solution of \f$Ax = b\f$.
+		 *
+		 * @param A Matrix A
+		 * @param x Vector in which to store solution
+		 * @param b Right-hand side of system
+		 * @return true on success and false on failure
+		 */
+		template <class Blackbox, class Vector>
+		bool solve (const Blackbox &A, Vector &x, const Vector &b);
+
+		/** Sample from the (right) nullspace of A
+		 *
+		 * @param A Matrix A
+		 * @param x Block into which to store the nullspace vectors: bit
+		 *          \p k of \c x[i] is entry \p i of vector \p k
+		 * @return Number of nullspace vectors found (at most 64)
+		 */
+		template <class Blackbox>
+		unsigned int sampleNullspace (const Blackbox &A, std::vector<Word> &x);
+
+		/** Interrupt the computations at the first checkpoint written
+		 * after \p iter iterations: \c solve then returns false and
+		 * \c sampleNullspace 0, and the checkpoint is kept for a later
+		 * call. \c 0 (the default) never interrupts.
+		 */
+		void stopAfter (size_t iter) { _stopAfter = iter; }
+
+		//! Whether the last computation was interrupted by \c stopAfter()
+		bool interrupted () const { return _interrupted; }
+
+	private:
+
+		enum { SolveMode = 1, NullspaceMode = 2 };
+
+		// B, in compressed row and compressed column form
+		struct PackedMatrix {
+			size_t rowdim, coldim;
+			std::vector<size_t>   rowStart, colStart;
+			std::vector<uint32_t> colIdx, rowIdx;
+		};
+
+		// State of the iteration between two steps, i.e. what a
+		// checkpoint holds. Index 0 is step i, 1 is step i - 1
+		struct State {
+			Word              mode;
+			std::vector<Word> v[3];      // V_i, V_i-1, V_i-2
+			std::vector<Word> x;         // solution block
+			std::vector<Word> b;         // right-hand side block, b = V_0
+			std::vector<Word> y;         // b = A y, but column 0 when solving
+			Word              winv[2][64]; // Winv_i-1, Winv_i-2
+			Word              vtav[64];  // V_i-1^T A V_i-1
+			Word              vta2v[64]; // (A V_i-1)^T A V_i-1
+			uint32_t          s[64];     // S_i-1, as column indices
+			size_t            dim;       // |S_i-1|
+			Word              mask;      // S_i-1, as a bit mask
+			size_t            iter;
+			size_t            dimSolved;
+		};
+
+		template <class Blackbox>
+		void pack (const Blackbox &A);
+
+		// Set up the iteration from st.b
+		void start (State &st) const;
+
+		// Run the block Lanczos iteration from st. Return false if the
+		// method breaks down
+		bool iterate (State &st);
+
+		// y = B v, y = B^T v and w = B^T B v
+		void mulB (std::vector<Word> &y, const std::vector<Word> &v) const;
+		void mulBT (std::vector<Word> &y, const std::vector<Word> &v) const;
+		void mulNormal (std::vector<Word> &w, const std::vector<Word> &v);
+
+		// c = x^T y
+		static void innerProduct (Word c[64], const std::vector<Word> &x, const std::vector<Word> &y);
+
+		// y += v M
+		static void mulAcc (std::vector<Word> &y, const std::vector<Word> &v, const Word M[64]);
+
+		// c = a b for 64 x 64 matrices; c may be a or b
+		static void mul64 (Word c[64], const Word a[64], const Word b[64]);
+
+		// Compute Winv_i and S_i given V_i^T A V_i and S_i-1. Return |S_i|,
+		// 0 on breakdown
+		static size_t findNonsingularSub (Word winv[64], uint32_t s[64], const Word T[64],
+						  const uint32_t lastS[64], size_t lastDim);
+
+		// tab[j][c] = sum of the rows 8j + k of M for the bits k of c
+		static void buildTable (Word tab[8][256], const Word M[64]);
+		static Word lookup (const Word tab[8][256], Word w);
+
+		void randomBlock (std::vector<Word> &v);
+
+		bool saveCheckpoint (const State &st) const;
+		bool loadCheckpoint (State &st, Word mode) const;
+		void removeCheckpoint () const;
+
+		const BlockLanczosTraits _traits;
+		std::mt19937_64          _gen;
+		PackedMatrix             _B;
+		std::vector<Word>        _tmp;        // B v, m words
+		size_t                   _stopAfter;
+		bool                     _interrupted;
+
+		// Below this number of words, products are sequential
+		static const size_t ParallelThreshold = 1 << 14;
+	};
+
+} // namespace LinBox
+
+#include "linbox/algorithms/gf2-block-lanczos.inl"
+
+#endif // __LINBOX_gf2_block_lanczos_H
+
+// Local Variables:
+// mode: C++
+// tab-width: 4
+// indent-tabs-mode: nil
+// c-basic-offset: 4
+// End:
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
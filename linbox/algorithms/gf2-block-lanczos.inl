@@ -0,0 +1,649 @@
+/* linbox/algorithms/gf2-block-lanczos.inl
+ * Copyright (C) 2026 the LinBox group
+ *
+ * ========LICENCE========
+ * This file is part of the library LinBox.
+ *
+ * LinBox is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ */
+
+#ifndef __LINBOX_gf2_block_lanczos_INL
+#define __LINBOX_gf2_block_lanczos_INL
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+#include "linbox/util/debug.h"
+#include "linbox/util/commentator.h"
+#include "linbox/util/timer.h"
+
+#ifdef __LINBOX_USE_OPENMP
+#include <omp.h>
+#endif
+
+namespace LinBox
+{
+
+	inline GF2BlockLanczosSolver::GF2BlockLanczosSolver (const GF2 &, const BlockLanczosTraits &traits, uint64_t seed) :
+		_traits (traits), _gen (seed ? seed : (uint64_t) BaseTimer::seed ()),
+		_stopAfter (0), _interrupted (false)
+	{}
+
+	template <class Blackbox, class Vector>
+	inline bool GF2BlockLanczosSolver::solve (const Blackbox &A, Vector &x, const Vector &b)
+	{
+		linbox_check ((x.size () == A.coldim ()) &&
+			      (b.size () == A.rowdim ()));
+
+		commentator().start ("Solving linear system (block Lanczos over GF(2))", "GF2BlockLanczosSolver::solve");
+
+		pack (A);
+		const size_t m = _B.rowdim, n = _B.coldim;
+
+		State st;
+		bool success = false;
+		bool resumed = loadCheckpoint (st, SolveMode);
+		_interrupted = false;
+		std::vector<Word> bw (m), t (n);
+
+		for (size_t r = 0; r < m; ++r)
+			bw[r] = b[r] ? 1 : 0;
+
+		for (unsigned int i = 0; !success && i < _traits.maxTries (); ++i) {
+			if (!resumed) {
+				// V_0 = b: B^T b in column 0, A y in the others, so that
+				// the block has full rank
+				st.mode = SolveMode;
+				st.y.resize (n);
+				randomBlock (st.y);
+				for (size_t k = 0; k < n; ++k)
+					st.y[k] &= ~Word (1);
+				mulNormal (st.b, st.y);
+				mulBT (t, bw);
+				for (size_t k = 0; k < n; ++k)
+					st.b[k] |= (t[k] & 1);
+				start (st);
+			}
+			else
+				commentator().report (Commentator::LEVEL_IMPORTANT, INTERNAL_DESCRIPTION)
+					<< "Resuming from iteration " << st.iter << std::endl;
+			resumed = false;
+
+			if (!iterate (st)) {
+				if (_interrupted) break;
+				continue;
+			}
+
+			// A = B^T B may be singular where B is not: x_0 is then only
+			// a solution of A x = B^T b. The other columns give vectors
+			// z_c = x_c - y_c of the kernel of A; look for a combination
+			// with B (x_0 + sum z_c) = b, by elimination on the rows of
+			// [B x_0 - b | B z_1 ... B z_63]
+			for (size_t k = 0; k < n; ++k)
+				t[k] = st.x[k] ^ st.y[k];
+			mulB (_tmp, t);
+			for (size_t r = 0; r < m; ++r)
+				_tmp[r] ^= bw[r];
+
+			size_t row = 0, pivotRow[64];
+			Word pivots = 0, comb = 0;
+			for (size_t c = 1; c < 64; ++c) {
+				const Word bit = Word (1) << c;
+				size_t r = row;
+				while (r < m && !(_tmp[r] & bit)) ++r;
+				if (r == m) continue;
+				std::swap (_tmp[r], _tmp[row]);
+				for (r = 0; r < m; ++r)
+					if (r != row && (_tmp[r] & bit))
+						_tmp[r] ^= _tmp[row];
+				pivots |= bit;
+				pivotRow[c] = row++;
+			}
+			for (size_t c = 1; c < 64; ++c)
+				if (((pivots >> c) & 1) && (_tmp[pivotRow[c]] & 1))
+					comb |= Word (1) << c;
+			for (size_t k = 0; k < n; ++k) {
+				Word w = t[k] & comb;
+				w ^= w >> 32; w ^= w >> 16; w ^= w >> 8;
+				w ^= w >> 4; w ^= w >> 2; w ^= w >> 1;
+				st.x[k] ^= (w & 1);
+			}
+
+			commentator().start ("Checking whether Ax=b");
+			mulB (_tmp, st.x);
+			success = true;
+			for (size_t r = 0; success && r < m; ++r)
+				if ((_tmp[r] & 1) != bw[r])
+					success = false;
+			commentator().stop (success ? "passed" : "FAILED");
+		}
+
+		if (success)
+			for (size_t k = 0; k < n; ++k)
+				x[k] = (st.x[k] & 1);
+
+		if (!_interrupted)
+			removeCheckpoint ();
+
+		commentator().stop ("done", (success ? "Solve successful" : (_interrupted ? "Solve interrupted" : "Solve failed")), "GF2BlockLanczosSolver::solve");
+
+		return success;
+	}
+
+	template <class Blackbox>
+	inline unsigned int GF2BlockLanczosSolver::sampleNullspace (const Blackbox &A, std::vector<Word> &x)
+	{
+		commentator().start ("Sampling from nullspace (block Lanczos over GF(2))", "GF2BlockLanczosSolver::sampleNullspace");
+
+		pack (A);
+		const size_t n = _B.coldim;
+
+		State st;
+		unsigned int number = 0;
+		bool resumed = loadCheckpoint (st, NullspaceMode);
+		_interrupted = false;
+
+		x.assign (n, 0);
+
+		for (unsigned int i = 0; number == 0 && i < _traits.maxTries (); ++i) {
+			if (!resumed) {
+				st.mode = NullspaceMode;
+				st.y.resize (n);
+				randomBlock (st.y);
+				mulNormal (st.b, st.y);
+				start (st);
+			}
+			resumed = false;
+
+			if (!iterate (st) && _interrupted)
+				break;
+
+			// Candidates are x - y; keep the nonzero columns z with B z = 0
+			std::vector<Word> &z = st.x;
+			Word nonzero = 0, bad = 0;
+			for (size_t k = 0; k < n; ++k) {
+				z[k] ^= st.y[k];
+				nonzero |= z[k];
+			}
+			mulB (_tmp, z);
+			for (size_t r = 0; r < _tmp.size (); ++r)
+				bad |= _tmp[r];
+			const Word good = nonzero & ~bad;
+
+			// Move the nullspace vectors to the first columns
+			for (size_t k = 0; k < n; ++k) {
+				Word w = 0;
+				unsigned int pos = 0;
+				for (unsigned int c = 0; c < 64; ++c)
+					if ((good >> c) & 1) {
+						w |= ((z[k] >> c) & 1) << pos;
+						++pos;
+					}
+				x[k] = w;
+				number = pos;
+			}
+		}
+
+		if (!_interrupted)
+			removeCheckpoint ();
+
+		commentator().stop (_interrupted ? "interrupted" : "done", NULL, "GF2BlockLanczosSolver::sampleNullspace");
+
+		return number;
+	}
+
+	template <class Blackbox>
+	inline void GF2BlockLanczosSolver::pack (const Blackbox &A)
+	{
+		linbox_check (A.coldim () < ((size_t) 1 << 32));
+		linbox_check (A.rowdim () < ((size_t) 1 << 32));
+
+		const size_t m = A.rowdim (), n = A.coldim ();
+		_B.rowdim = m;
+		_B.coldim = n;
+		_B.rowStart.assign (m + 1, 0);
+		_B.colStart.assign (n + 1, 0);
+		_B.colIdx.clear ();
+
+		for (size_t i = 0; i < m; ++i) {
+			for (typename Blackbox::Row_t::const_iterator j = A[i].begin (); j != A[i].end (); ++j) {
+				_B.colIdx.push_back ((uint32_t) *j);
+				++_B.colStart[*j + 1];
+			}
+			_B.rowStart[i + 1] = _B.colIdx.size ();
+		}
+
+		// Column copy, by counting sort of the row copy
+		for (size_t j = 0; j < n; ++j)
+			_B.colStart[j + 1] += _B.colStart[j];
+		_B.rowIdx.resize (_B.colIdx.size ());
+		std::vector<size_t> pos (_B.colStart.begin (), _B.colStart.end () - 1);
+		for (size_t i = 0; i < m; ++i)
+			for (size_t k = _B.rowStart[i]; k < _B.rowStart[i + 1]; ++k)
+				_B.rowIdx[pos[_B.colIdx[k]]++] = (uint32_t) i;
+
+		_tmp.resize (m);
+	}
+
+	inline void GF2BlockLanczosSolver::start (State &st) const
+	{
+		const size_t n = _B.coldim;
+		st.v[0] = st.b;
+		st.v[1].assign (n, 0);
+		st.v[2].assign (n, 0);
+		st.x.assign (n, 0);
+		for (size_t i = 0; i < 64; ++i) {
+			st.winv[0][i] = st.winv[1][i] = 0;
+			st.vtav[i] = st.vta2v[i] = 0;
+			st.s[i] = (uint32_t) i;
+		}
+		st.dim = 64;
+		st.mask = ~Word (0);
+		st.iter = 0;
+		st.dimSolved = 0;
+	}
+
+	inline bool GF2BlockLanczosSolver::iterate (State &st)
+	{
+		const size_t n = _B.coldim;
+
+		commentator().start ("Block Lanczos iteration", "GF2BlockLanczosSolver::iterate", n);
+
+		std::vector<Word> vnext (n);
+		Word vtav[64], vta2v[64], winv[64], d[64], e[64], f[64], f2[64];
+		uint32_t s[64];
+		bool ret = true;
+
+		const bool checkpoint = !_traits.checkpointFile ().empty () && _traits.checkpointInterval ();
+
+		while (1) {
+			if (checkpoint && st.iter && !(st.iter % _traits.checkpointInterval ())) {
+				saveCheckpoint (st);
+				if (_stopAfter && st.iter >= _stopAfter) {
+					_interrupted = true;
+					ret = false;
+					break;
+				}
+			}
+
+			++st.iter;
+
+			mulNormal (vnext, st.v[0]);
+			innerProduct (vtav, st.v[0], vnext);
+			innerProduct (vta2v, vnext, vnext);
+
+			// V^T A V = 0: the iteration is over
+			if (std::find_if (vtav, vtav + 64, [](Word w) { return w != 0; }) == vtav + 64)
+				break;
+
+			const size_t dim = findNonsingularSub (winv, s, vtav, st.s, st.dim);
+			if (dim == 0) {
+				ret = false;
+				break;
+			}
+
+			Word mask = 0;
+			for (size_t i = 0; i < dim; ++i)
+				mask |= Word (1) << s[i];
+
+			st.dimSolved += dim;
+			if (st.dimSolved > n + 64) {
+				commentator().report (Commentator::LEVEL_IMPORTANT, INTERNAL_ERROR)
+					<< "Maximum number of iterations passed without termination" << std::endl;
+				ret = false;
+				break;
+			}
+
+			// D_i+1 = I_N - Winv_i (V_i^T A^2 V_i S_i S_i^T + V_i^T A V_i)
+			for (size_t i = 0; i < 64; ++i)
+				d[i] = (vta2v[i] & mask) ^ vtav[i];
+			mul64 (d, winv, d);
+			for (size_t i = 0; i < 64; ++i)
+				d[i] ^= Word (1) << i;
+
+			// E_i+1 = - Winv_i-1 V_i^T A V_i S_i S_i^T
+			mul64 (e, st.winv[0], vtav);
+			for (size_t i = 0; i < 64; ++i)
+				e[i] &= mask;
+
+			// F_i+1 = - Winv_i-2 (I_N - V_i-1^T A V_i-1 Winv_i-1)
+			//         (V_i-1^T A^2 V_i-1 S_i-1 S_i-1^T + V_i-1^T A V_i-1) S_i S_i^T
+			mul64 (f, st.vtav, st.winv[0]);
+			for (size_t i = 0; i < 64; ++i)
+				f[i] ^= Word (1) << i;
+			mul64 (f, st.winv[1], f);
+			for (size_t i = 0; i < 64; ++i)
+				f2[i] = ((st.vta2v[i] & st.mask) ^ st.vtav[i]) & mask;
+			mul64 (f, f, f2);
+
+			// V_i+1 = A V_i S_i S_i^T + V_i D_i+1 + V_i-1 E_i+1 + V_i-2 F_i+1
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for schedule(static) if (n > ParallelThreshold)
+#endif
+			for (long k = 0; k < (long) n; ++k)
+				vnext[(size_t) k] &= mask;
+			mulAcc (vnext, st.v[0], d);
+			mulAcc (vnext, st.v[1], e);
+			mulAcc (vnext, st.v[2], f);
+
+			// x += V_i Winv_i V_i^T b
+			innerProduct (d, st.v[0], st.b);
+			mul64 (d, winv, d);
+			mulAcc (st.x, st.v[0], d);
+
+			std::swap (st.v[2], st.v[1]);
+			std::swap (st.v[1], st.v[0]);
+			std::swap (st.v[0], vnext);
+
+			std::copy (st.winv[0], st.winv[0] + 64, st.winv[1]);
+			std::copy (winv, winv + 64, st.winv[0]);
+			std::copy (vtav, vtav + 64, st.vtav);
+			std::copy (vta2v, vta2v + 64, st.vta2v);
+			std::copy (s, s + dim, st.s);
+			st.dim = dim;
+			st.mask = mask;
+
+			commentator().progress ((long) st.dimSolved);
+		}
+
+		commentator().stop (ret ? "done" : (_interrupted ? "interrupted" : "breakdown"), NULL, "GF2BlockLanczosSolver::iterate");
+
+		return ret;
+	}
+
+	inline void GF2BlockLanczosSolver::mulB (std::vector<Word> &y, const std::vector<Word> &v) const
+	{
+		y.resize (_B.rowdim);
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for schedule(dynamic, 1024) if (_B.colIdx.size () > ParallelThreshold)
+#endif
+		for (long i = 0; i < (long) _B.rowdim; ++i) {
+			Word w = 0;
+			for (size_t k = _B.rowStart[(size_t) i]; k < _B.rowStart[(size_t) i + 1]; ++k)
+				w ^= v[_B.colIdx[k]];
+			y[(size_t) i] = w;
+		}
+	}
+
+	inline void GF2BlockLanczosSolver::mulBT (std::vector<Word> &y, const std::vector<Word> &v) const
+	{
+		y.resize (_B.coldim);
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for schedule(dynamic, 1024) if (_B.rowIdx.size () > ParallelThreshold)
+#endif
+		for (long j = 0; j < (long) _B.coldim; ++j) {
+			Word w = 0;
+			for (size_t k = _B.colStart[(size_t) j]; k < _B.colStart[(size_t) j + 1]; ++k)
+				w ^= v[_B.rowIdx[k]];
+			y[(size_t) j] = w;
+		}
+	}
+
+	inline void GF2BlockLanczosSolver::mulNormal (std::vector<Word> &w, const std::vector<Word> &v)
+	{
+		mulB (_tmp, v);
+		mulBT (w, _tmp);
+	}
+
+	inline void GF2BlockLanczosSolver::innerProduct (Word c[64], const std::vector<Word> &x, const std::vector<Word> &y)
+	{
+		linbox_check (x.size () == y.size ());
+
+		const size_t n = x.size ();
+		std::fill (c, c + 64, Word (0));
+
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel if (n > ParallelThreshold)
+#endif
+		{
+			// tab[j][c] = sum of the y[k] such that byte j of x[k] is c
+			std::vector<Word> tab (8 * 256, 0);
+			Word part[64];
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp for schedule(static)
+#endif
+			for (long k = 0; k < (long) n; ++k) {
+				const Word xk = x[(size_t) k], yk = y[(size_t) k];
+				for (size_t j = 0; j < 8; ++j)
+					tab[j * 256 + ((xk >> (8 * j)) & 0xff)] ^= yk;
+			}
+
+			for (size_t j = 0; j < 8; ++j)
+				for (size_t b = 0; b < 8; ++b) {
+					Word w = 0;
+					for (size_t v = 0; v < 256; ++v)
+						if ((v >> b) & 1)
+							w ^= tab[j * 256 + v];
+					part[8 * j + b] = w;
+				}
+
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp critical (GF2BlockLanczosInnerProduct)
+#endif
+			for (size_t i = 0; i < 64; ++i)
+				c[i] ^= part[i];
+		}
+	}
+
+	inline void GF2BlockLanczosSolver::buildTable (Word tab[8][256], const Word M[64])
+	{
+		for (size_t j = 0; j < 8; ++j) {
+			tab[j][0] = 0;
+			for (size_t b = 0; b < 8; ++b)
+				for (size_t v = 0; v < ((size_t) 1 << b); ++v)
+					tab[j][v | ((size_t) 1 << b)] = tab[j][v] ^ M[8 * j + b];
+		}
+	}
+
+	inline GF2BlockLanczosSolver::Word GF2BlockLanczosSolver::lookup (const Word tab[8][256], Word w)
+	{
+		return tab[0][w & 0xff] ^ tab[1][(w >> 8) & 0xff]
+			^ tab[2][(w >> 16) & 0xff] ^ tab[3][(w >> 24) & 0xff]
+			^ tab[4][(w >> 32) & 0xff] ^ tab[5][(w >> 40) & 0xff]
+			^ tab[6][(w >> 48) & 0xff] ^ tab[7][(w >> 56) & 0xff];
+	}
+
+	inline void GF2BlockLanczosSolver::mulAcc (std::vector<Word> &y, const std::vector<Word> &v, const Word M[64])
+	{
+		linbox_check (y.size () == v.size ());
+
+		Word tab[8][256];
+		buildTable (tab, M);
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for schedule(static) if (v.size () > ParallelThreshold)
+#endif
+		for (long k = 0; k < (long) v.size (); ++k)
+			y[(size_t) k] ^= lookup (tab, v[(size_t) k]);
+	}
+
+	inline void GF2BlockLanczosSolver::mul64 (Word c[64], const Word a[64], const Word b[64])
+	{
+		Word tab[8][256], t[64];
+		buildTable (tab, b);
+		for (size_t i = 0; i < 64; ++i)
+			t[i] = lookup (tab, a[i]);
+		std::copy (t, t + 64, c);
+	}
+
+	// Gauss-Jordan on [T | I_N], taking the pivots first among the columns
+	// not in S_i-1. A column without pivot in T is dropped from S_i and
+	// eliminated with the right half instead (Montgomery 1995, Section 8)
+	inline size_t GF2BlockLanczosSolver::findNonsingularSub (Word winv[64], uint32_t s[64], const Word T[64],
+								  const uint32_t lastS[64], size_t lastDim)
+	{
+		Word M[64][2];
+		for (size_t i = 0; i < 64; ++i) {
+			M[i][0] = T[i];
+			M[i][1] = Word (1) << i;
+		}
+
+		// Columns of S_i-1 at the end, the others first
+		Word mask = 0;
+		for (size_t i = 0; i < lastDim; ++i) {
+			mask |= Word (1) << lastS[i];
+			s[63 - i] = lastS[i];
+		}
+		for (size_t i = 0, j = 0; i < 64; ++i)
+			if (!((mask >> i) & 1))
+				s[j++] = (uint32_t) i;
+
+		size_t dim = 0;
+		for (size_t i = 0; i < 64; ++i) {
+			const Word bit = Word (1) << s[i];
+			Word *rowi = M[s[i]];
+
+			size_t j;
+			for (j = i; j < 64; ++j)
+				if (M[s[j]][0] & bit) {
+					std::swap (M[s[j]][0], rowi[0]);
+					std::swap (M[s[j]][1], rowi[1]);
+					break;
+				}
+
+			if (j < 64) {
+				for (j = 0; j < 64; ++j) {
+					Word *rowj = M[s[j]];
+					if (rowj != rowi && (rowj[0] & bit)) {
+						rowj[0] ^= rowi[0];
+						rowj[1] ^= rowi[1];
+					}
+				}
+				s[dim++] = s[i];
+				continue;
+			}
+
+			for (j = i; j < 64; ++j)
+				if (M[s[j]][1] & bit) {
+					std::swap (M[s[j]][0], rowi[0]);
+					std::swap (M[s[j]][1], rowi[1]);
+					break;
+				}
+			if (j == 64)
+				return 0;
+
+			for (j = 0; j < 64; ++j) {
+				Word *rowj = M[s[j]];
+				if (rowj != rowi && (rowj[1] & bit)) {
+					rowj[0] ^= rowi[0];
+					rowj[1] ^= rowi[1];
+				}
+			}
+			rowi[0] = rowi[1] = 0;
+		}
+
+		for (size_t i = 0; i < 64; ++i)
+			winv[i] = M[i][1];
+
+		// Every column must be in S_i or in S_i-1
+		mask = 0;
+		for (size_t i = 0; i < dim; ++i)
+			mask |= Word (1) << s[i];
+		for (size_t i = 0; i < lastDim; ++i)
+			mask |= Word (1) << lastS[i];
+
+		return (mask == ~Word (0)) ? dim : 0;
+	}
+
+	inline void GF2BlockLanczosSolver::randomBlock (std::vector<Word> &v)
+	{
+		for (size_t k = 0; k < v.size (); ++k)
+			v[k] = _gen ();
+	}
+
+	// Checkpoint layout, in words: mode, m, n, nnz, iter, dimSolved, dim,
+	// mask, |y|, then S_i-1, Winv_i-1, Winv_i-2, V^T A V, V^T A^2 V, and
+	// the blocks V_i, V_i-1, V_i-2, x, b, y
+	inline bool GF2BlockLanczosSolver::saveCheckpoint (const State &st) const
+	{
+		const std::string tmpname = _traits.checkpointFile () + ".tmp";
+		std::ofstream out (tmpname.c_str (), std::ios::binary);
+		if (!out) return false;
+
+		const Word header[9] = { st.mode, _B.rowdim, _B.coldim, _B.colIdx.size (), st.iter,
+			st.dimSolved, st.dim, st.mask, st.y.size () };
+		Word s[64];
+		std::copy (st.s, st.s + 64, s);
+
+		out.write (reinterpret_cast<const char *> (header), sizeof (header));
+		out.write (reinterpret_cast<const char *> (s), sizeof (s));
+		out.write (reinterpret_cast<const char *> (st.winv), sizeof (st.winv));
+		out.write (reinterpret_cast<const char *> (st.vtav), sizeof (st.vtav));
+		out.write (reinterpret_cast<const char *> (st.vta2v), sizeof (st.vta2v));
+		const std::vector<Word> *blocks[6] = { &st.v[0], &st.v[1], &st.v[2], &st.x, &st.b, &st.y };
+		for (size_t i = 0; i < 6; ++i)
+			if (blocks[i]->size ())
+				out.write (reinterpret_cast<const char *> (&(*blocks[i])[0]), (std::streamsize) (blocks[i]->size () * sizeof (Word)));
+		out.close ();
+		if (!out) return false;
+
+		// Replace the previous checkpoint only once the new one is complete
+		return std::rename (tmpname.c_str (), _traits.checkpointFile ().c_str ()) == 0;
+	}
+
+	inline bool GF2BlockLanczosSolver::loadCheckpoint (State &st, Word mode) const
+	{
+		if (_traits.checkpointFile ().empty ())
+			return false;
+		std::ifstream in (_traits.checkpointFile ().c_str (), std::ios::binary);
+		if (!in) return false;
+
+		Word header[9];
+		in.read (reinterpret_cast<char *> (header), sizeof (header));
+		if (!in || header[0] != mode || header[1] != _B.rowdim || header[2] != _B.coldim
+		    || header[3] != _B.colIdx.size ())
+			return false;
+
+		Word s[64];
+		in.read (reinterpret_cast<char *> (s), sizeof (s));
+		in.read (reinterpret_cast<char *> (st.winv), sizeof (st.winv));
+		in.read (reinterpret_cast<char *> (st.vtav), sizeof (st.vtav));
+		in.read (reinterpret_cast<char *> (st.vta2v), sizeof (st.vta2v));
+		std::vector<Word> *blocks[6] = { &st.v[0], &st.v[1], &st.v[2], &st.x, &st.b, &st.y };
+		for (size_t i = 0; i < 6; ++i) {
+			blocks[i]->resize (i < 5 ? _B.coldim : (size_t) header[8]);
+			if (blocks[i]->size ())
+				in.read (reinterpret_cast<char *> (&(*blocks[i])[0]), (std::streamsize) (blocks[i]->size () * sizeof (Word)));
+		}
+		if (!in) return false;
+
+		st.mode = mode;
+		st.iter = (size_t) header[4];
+		st.dimSolved = (size_t) header[5];
+		st.dim = (size_t) header[6];
+		st.mask = header[7];
+		for (size_t i = 0; i < 64; ++i)
+			st.s[i] = (uint32_t) s[i];
+		return true;
+	}
+
+	inline void GF2BlockLanczosSolver::removeCheckpoint () const
+	{
+		if (!_traits.checkpointFile ().empty ())
+			std::remove (_traits.checkpointFile ().c_str ());
+	}
+
+} // namespace LinBox
+
+#endif // __LINBOX_gf2_block_lanczos_INL
+
+// Local Variables:
+// mode: C++
+// tab-width: 4
+// indent-tabs-mode: nil
+// c-basic-offset: 4
+// End:
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
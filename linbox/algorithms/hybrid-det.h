@@ -40,6 +40,13 @@
 #include "linbox/algorithms/matrix-hom.h"
 #include "linbox/solutions/det.h"
 
+#include <set>
+#include <memory>
+#include <utility>
+#ifdef __LINBOX_USE_OPENMP
+#include <omp.h>
+#endif
+
 // #define _LB_H_DET_TIMING
 
 namespace LinBox
@@ -130,6 +137,162 @@ namespace LinBox
 
 	};
 
+#ifdef __LINBOX_USE_OPENMP
+	/** \brief Task parallel hybrid determinant.
+	 *
+	 * Same algorithm as \c lif_cra_det, but the two streams run at the
+	 * same time: one task does the last invariant factor Dixon solve
+	 * while the other threads compute determinants modulo primes. Every
+	 * modular determinant feeds an early terminated CRA of \f$\det A\f$
+	 * and, once the solve gives a divisor \f$\beta\f$, a second one of
+	 * \f$\det A/\beta\f$, that usually terminates within a few primes.
+	 * The residues are kept, so that the second CRA starts with all the
+	 * primes done so far. As in \c lif_cra_det, there is no second solve
+	 * for the bonus.
+	 *
+	 * A running Dixon solve cannot be interrupted: if the modular
+	 * determinants terminate first, the result is returned once it is over.
+	 */
+	template <class Blackbox, class MyMethod>
+	typename Blackbox::Field::Element & lif_cra_det_omp (typename Blackbox::Field::Element         &d,
+							     const Blackbox                            &A,
+							     const RingCategories::IntegerTag          &tag,
+							     const MyMethod                            &M)
+	{
+		typedef Givaro::ModularBalanced<double> mymodular;
+		typedef typename Blackbox::Field Integers;
+		typedef typename Integers::Element Integer_t;
+		typedef PrimeIterator<IteratorCategories::HeuristicTag> MyPrimeIterator;
+		typedef RationalSolver < Integers, mymodular, MyPrimeIterator, DixonTraits > Solver;
+		typedef typename Blackbox::template rebind<mymodular>::other FBlackbox;
+
+		commentator().start ("Integer Determinant - task parallel hybrid version ", "det");
+
+		MyPrimeIterator genprime(FieldTraits<mymodular>::bestBitSize(A.coldim()));
+		std::set<integer> used;
+		std::vector< std::pair<integer, mymodular::Element> > images; // (p, det A mod p)
+		EarlySingleCRA<mymodular> cra(4UL);       // det A
+		std::unique_ptr< EarlySingleCRA<mymodular> > cra2(new EarlySingleCRA<mymodular>(4UL)); // det A / beta
+		size_t cra2count = 0;
+		Integer_t beta = 1;
+		bool zero = false, stop = false;
+
+		// The following are only called within critical(lif_cra_det_omp)
+
+		// adds det A mod p to the CRA of det A / beta
+		auto reduced = [&] (const integer & p, const mymodular::Element & r)
+		{
+			mymodular D(p);
+			mymodular::Element b, x;
+			D.init(b, beta);
+			if (D.isZero(b)) return;
+			D.div(x, r, b);
+			if (cra2count++ == 0)
+				cra2->initialize(D, x);
+			else
+				cra2->progress(D, x);
+		};
+
+		// a new divisor: replay all the images
+		auto setbeta = [&] (const Integer_t & b)
+		{
+			beta = b;
+			cra2.reset(new EarlySingleCRA<mymodular>(4UL));
+			cra2count = 0;
+			for (size_t i = 0; i < images.size(); ++i)
+				reduced(images[i].first, images[i].second);
+			stop = stop || (cra2count && cra2->terminated());
+		};
+
+		const size_t nthreads = (size_t) omp_get_max_threads();
+
+#pragma omp parallel
+#pragma omp single
+		{
+			// Dixon solve
+#pragma omp task shared(A, beta, zero, stop)
+			{
+				BlasVector<Integers> r_num1 (A.field(), A.coldim());
+				Solver RSolver;
+				LastInvariantFactor < Integers, Solver > LIF(RSolver);
+				Integer_t lif = 1;
+				bool cont;
+#pragma omp critical(lif_cra_det_omp)
+				cont = !stop;
+				if (cont) {
+					LIF.lastInvariantFactor1(lif, r_num1, A);
+#pragma omp critical(lif_cra_det_omp)
+					{
+						if (lif == 0)
+							zero = stop = true;
+						else
+							setbeta(lif);
+					}
+				}
+			}
+
+			// modular determinants
+			for (size_t t = 0; t < std::max(nthreads, (size_t)2) - 1; ++t) {
+#pragma omp task shared(A, M, genprime, used, images, cra, stop)
+				{
+					bool cont = true;
+					while (cont) {
+						integer p;
+#pragma omp critical(lif_cra_det_omp)
+						{
+							do { ++genprime; } while (used.count(*genprime) || cra.noncoprime(*genprime));
+							p = *genprime;
+							used.insert(p);
+							cont = !stop;
+						}
+						if (!cont) break;
+
+						mymodular D(p);
+						mymodular::Element r;
+						FBlackbox Ap(A, D);
+						detin(r, Ap, M);
+
+#pragma omp critical(lif_cra_det_omp)
+						{
+							if (images.empty())
+								cra.initialize(D, r);
+							else
+								cra.progress(D, r);
+							images.push_back(std::make_pair(p, r));
+							if (beta > 1)
+								reduced(p, r);
+							stop = stop || cra.terminated() || (cra2count && cra2->terminated());
+							cont = !stop;
+						}
+					}
+				}
+			}
+#pragma omp taskwait
+		}
+
+		if (zero) {
+			d = 0;
+			commentator().stop ("is 0", NULL, "det");
+			return d;
+		}
+		if (cra.terminated()) {
+			cra.result(d);
+			commentator().stop ("first step", NULL, "det");
+		}
+		else {
+			Integer_t k;
+			cra2->result(k);
+			d = k*beta;
+			commentator().report(Commentator::LEVEL_NORMAL, INTERNAL_DESCRIPTION)
+			<< "det/lif " << k<< "\n";
+			commentator().stop ("second step", NULL, "det");
+		}
+		commentator().report (Commentator::LEVEL_NORMAL, INTERNAL_DESCRIPTION)
+		<< "Iterations done " << images.size() << "\n";
+		return d;
+	}
+#endif
+
 	/** \brief Compute the determinant of A over the integers
 	 *
 	 * The determinant of a linear operator A, represented as a
@@ -140,6 +303,7 @@ namespace LinBox
 	 * Then switches to the LIF method, producing a factor of det.
 	 * It then comes back to the CRA if necessary to compute
 	 * the remaining (usually small) factor of the determinant.
+	 * With OpenMP and more than one thread, \c lif_cra_det_omp is used.
 	 *
 	 * @param d Field element into which to store the result
 	 * @param A Black box of which to compute the determinant
@@ -158,6 +322,10 @@ namespace LinBox
 		typedef typename Blackbox::Field Integers;
 		typedef typename Integers::Element Integer_t;
 
+#ifdef __LINBOX_USE_OPENMP
+		if (omp_get_max_threads() > 1)
+			return lif_cra_det_omp(d, A, tag, M);
+#endif
 		commentator().start ("Integer Determinant - hybrid version ", "det");
 		size_t myfactor=5;
 		size_t early_counter=0;
@@ -42,6 +42,7 @@
 #include "linbox/algorithms/blackbox-block-container.h"
 #include "linbox/algorithms/block-massey-domain.h"
 #include "linbox/algorithms/gauss.h"
+#include "linbox/algorithms/triangular-solve.h"
 #include "linbox/vector/vector-domain.h"
 #include "linbox/blackbox/compose.h"
 #include "linbox/blackbox/block-hankel-inverse.h"
@@ -1449,7 +1450,10 @@ namespace LinBox
 	}; // end of class BlockHankelLiftingContainer
 
 
-	///  SparseLULiftingContainer.
+	/**  SparseLULiftingContainer.
+	 * The triangular factors are analysed once, in level sets, and each
+	 * digit is solved with the resulting @ref SparseTriangularSolver.
+	 */
 	template <class _Ring, class _Field, class _IMatrix, class _FMatrix>
 	class SparseLULiftingContainer : public LiftingContainerBase< _Ring, _IMatrix> {
 
@@ -1473,7 +1477,8 @@ namespace LinBox
 		const Field                     *_field;
 		mutable FVector                  _res_p;
 		mutable FVector                _digit_p;
-		GaussDomain<Field>                  _GD;
+		SparseTriangularSolver<Field>   _Lsolve;
+		SparseTriangularSolver<Field>   _Usolve;
 
 
 	public:
@@ -1491,7 +1496,8 @@ namespace LinBox
 					  const VectorIn&    b,
 					  const Prime_Type&  p) :
 			LiftingContainerBase<Ring,IMatrix> (R,A,b,p), LL(L),UU(U),QQ(Q), PP(P), _rank(rank),
-			_field(&F), _res_p(F,b.size()), _digit_p(F,A.coldim()), _GD(F)
+			_field(&F), _res_p(F,b.size()), _digit_p(F,A.coldim()),
+			_Lsolve(L, Tag::Shape::Lower), _Usolve(U, Tag::Shape::Upper)
 		{
 			for (size_t i=0; i< _res_p.size(); ++i)
 				field().init(_res_p[i]);
@@ -1519,9 +1525,14 @@ namespace LinBox
 					hom.image(*iter_p, *iter);
 			}
 
-                        FVector w(field(), UU.coldim());
 			// solve the system mod p using L.Q.U.P Factorization
-			_GD.solve(_digit_p, w, _rank, QQ,LL,UU,PP, _res_p);
+			// Q L U P x = b, the unknowns of w past the rank of U are zero
+			FVector y(field(), UU.rowdim(), field().zero), v(field(), UU.rowdim(), field().zero);
+			FVector w(field(), UU.coldim(), field().zero);
+			QQ.applyTranspose(y, _res_p);
+			_Lsolve.solve(v, y);
+			_Usolve.solve(w, v);
+			PP.applyTranspose(_digit_p, w);
 
                         // promote new solution mod p to integers
 			{
@@ -30,150 +30,161 @@
 
 #include "givaro/random-integer.h"
 #include "linbox/randiter/random-prime.h"
+#include "linbox/randiter/prime-pool.h"
+#include "linbox/algorithms/rns.h"
 
+#include <cmath>
+#include <fflas-ffpack/fflas/fflas.h>
 
-namespace LinBox { namespace BLAS3 { namespace Protected {
-
-	struct IntegerCraMatMul {
-
-
-		typedef Givaro::Modular<double>     Field;
-		typedef Field::Element      Element;
-		typedef BlasMatrix<Field>   ModularMatrix ;
-		typedef BlasMatrix<Givaro::ZRing<Integer> > IntegerMatrix ;
-
-#ifdef _LB_MM_TIMING
-#ifdef _OPENMP
-		typedef LinBox::OMPTimer Mytime;
-#else
-		typedef LinBox::Timer    Mytime;
+#ifdef __LINBOX_USE_OPENMP
+#include <omp.h>
 #endif
+
+/*! Entries of more than this number of bits are split by
+ * BLAS3::mul(C,A,B,mulMethod::ToomCookSplit) before the multimodular product.
+ */
+#ifndef LINBOX_MUL_TOOMCOOK_THRESHOLD
+#define LINBOX_MUL_TOOMCOOK_THRESHOLD 8192
 #endif
 
-		const IntegerMatrix &_A_, &_B_;
 
-#ifdef _LB_MM_TIMING
-		mutable Mytime chrono;
-#endif
+namespace LinBox { namespace BLAS3 { namespace Protected {
 
-		IntegerCraMatMul(const IntegerMatrix& A, const IntegerMatrix& B) :
-			_A_(A), _B_(B)
-		{
-#ifdef _LB_MM_TIMING
-			chrono.clear();
-#endif
-			linbox_check(A.getPointer() == _A_.getPointer());
+	/*! log2 of the largest Euclidean norm of a row (or column) of \p A,
+	 * \c -HUGE_VAL if \p A is zero.
+	 */
+	template<class _anyMatrix>
+	double maxLog2Norm(const _anyMatrix & A, bool byRow)
+	{
+		const size_t outer = byRow ? A.rowdim() : A.coldim() ;
+		const size_t inner = byRow ? A.coldim() : A.rowdim() ;
+		std::vector<double> l(inner);
+		double best = -HUGE_VAL ;
+		for (size_t a = 0 ; a < outer ; ++a) {
+			// l_b = log2(x_b^2), summed as 2^lmax sum 2^(l_b-lmax)
+			double lmax = -HUGE_VAL ;
+			for (size_t b = 0 ; b < inner ; ++b) {
+				const Integer & x = byRow ? A.getEntry(a,b) : A.getEntry(b,a) ;
+				if (x == 0) { l[b] = -HUGE_VAL ; continue ; }
+				long e ;
+				double d = mpz_get_d_2exp(&e, x.get_mpz_const());
+				l[b] = 2*((double)e + std::log2(std::fabs(d))) ;
+				lmax = std::max(lmax, l[b]);
+			}
+			if (lmax == -HUGE_VAL) continue ;
+			double sum = 0 ;
+			for (size_t b = 0 ; b < inner ; ++b)
+				if (l[b] != -HUGE_VAL)
+					sum += std::exp2(l[b] - lmax) ;
+			best = std::max(best, (lmax + std::log2(sum))/2) ;
 		}
+		return best ;
+	}
 
-		IntegerCraMatMul(IntegerMatrix& A, IntegerMatrix& B) :
-			_A_(A), _B_(B)
-		{
-#ifdef _LB_MM_TIMING
-			chrono.clear();
-#endif
-			linbox_check(A.getPointer() == _A_.getPointer());
+	/*! Multimodular product with a fixed set of primes.
+	 * There are just enough primes for \f$2^{logC+1}\f$, \p logC bounding
+	 * \f$\log_2 |C_{i,j}|\f$. \p A and \p B are mapped to all the primes at
+	 * once by RNSBlasConverter::reduce, the products modulo each prime are
+	 * independent fgemms run by different threads, and \p C is
+	 * reconstructed by RNSBlasConverter::convert.
+	 */
+	template<class _anyMatrix>
+	_anyMatrix & mulRNS(_anyMatrix & C, const _anyMatrix & A, const _anyMatrix & B, double logC)
+	{
+		typedef Givaro::Modular<double> ModularField ;
+		const size_t m = A.rowdim(), k = A.coldim(), n = B.coldim() ;
+
+		const uint64_t bits = std::min(FieldTraits<ModularField>::bestBitSize(k), (uint64_t)26) ;
+		PrimePool<ModularField> & pool = PrimePool<ModularField>::instance(bits);
+		std::vector<integer> primes ;
+		std::vector<const ModularField*> fields ;
+		double logM = 0 ;
+		while (logM < logC + 2) { // one bit for the sign, one for rounding
+			const size_t i = primes.size() ;
+			primes.push_back(integer(pool.prime(i)));
+			fields.push_back(&pool.field(i));
+			logM += std::log2((double)pool.prime(i)) ;
 		}
-
-		ModularMatrix& operator()(ModularMatrix& Cp, const Field& F) const
-		{
-			BlasMatrixDomain<Field>   BMD(F);
-
-			/*  intialisation */
-			// ModularMatrix Cpp(_A_.rowdim(),_B_.coldim());
-			// Cp = Cpp ;
-			ModularMatrix Ap(_A_, F);
-			ModularMatrix Bp(_B_, F);
-			Cp.resize(Ap.rowdim(),Bp.coldim());
-
-			/*  multiplication mod p */
-
-#ifdef _LB_MM_TIMING
-			Mytime matmul; matmul.clear(); matmul.start();
+		RNSBlasConverter RNS(primes);
+		linbox_check(RNS.usable());
+		const size_t s = primes.size() ;
+
+		std::vector<double> Ar(s*m*k), Br(s*k*n), Cr(s*m*n);
+		if (A.getStride() == k)
+			RNS.reduce(&Ar[0], m*k, A.getPointer(), 1, m*k);
+		else
+			for (size_t i = 0 ; i < m ; ++i)
+				RNS.reduce(&Ar[i*k], m*k, A.getPointer()+i*A.getStride(), 1, k);
+		if (B.getStride() == n)
+			RNS.reduce(&Br[0], k*n, B.getPointer(), 1, k*n);
+		else
+			for (size_t i = 0 ; i < k ; ++i)
+				RNS.reduce(&Br[i*n], k*n, B.getPointer()+i*B.getStride(), 1, n);
+
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for schedule(dynamic)
 #endif
-			BMD.mul(Cp,Ap,Bp);
-			// BMD.axpyin(Cp,Ap,Bp);
-#if 0
-			// BMD.mul( static_cast<BlasMatrix<double>&>(Cp),Ap,Bp);
-			if (FAM_TYPE == _axpy)
-				BMD.axpyin(Cp,Ap,Bp);
-			else if (FAM_TYPE == _axmy)
-				BMD.axmyin(Cp,Ap,Bp);
-			else if (FAM_TYPE == _maxpy)
-				BMD.maxpyin(Cp,Ap,Bp);
-#endif
-#ifdef _LB_MM_TIMING
-			matmul.stop();
-			this->chrono+=matmul;
-#endif
-#if 0
-			if (Ap.rowdim() <= 20 && Ap.coldim() <= 20) {
-				Integer chara;
-				F.characteristic(chara);
-				F.write(cout) << endl;
-				cout << "p:=" << chara << ';' << std::endl;
-				A.write(cout<< "A:=",true) << ';' << std::endl;
-				Ap.write(cout << "Ap:=", F, true) << ';' << endl;
-				Bp.write(cout << "Bp:=", F, true) << ';' << endl;
-				Cp.write(cout<< "Cp:=", F, true) << ';' << endl;
-			}
-#endif
-			return Cp;
+		for (long ii = 0 ; ii < (long)s ; ++ii) {
+			const size_t i = (size_t)ii ;
+			const ModularField & F = *fields[i] ;
+			FFLAS::fgemm(F, FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, m, n, k,
+				     F.one, &Ar[i*m*k], k, &Br[i*k*n], n,
+				     F.zero, &Cr[i*m*n], n);
 		}
 
-
-
-	};
+		if (C.getStride() == n)
+			RNS.convert(C.getPointer(), 1, &Cr[0], m*n, m*n, true);
+		else
+			for (size_t i = 0 ; i < m ; ++i)
+				RNS.convert(C.getPointer()+i*C.getStride(), 1, &Cr[i*n], n, m*n, true);
+		return C ;
+	}
 
 } // Protected
 } // BLAS3
 } // LinBox
 
-namespace LinBox {
-	template<class Field>
-	struct CRATemporaryVectorTrait<BLAS3::Protected::IntegerCraMatMul, Field> {
-		// typedef typename std::vector<double>::iterator Type_t ;
-		typedef typename LinBox::BlasMatrix<Field > Type_t;
-	};
-} // LinBox
-
-
 namespace LinBox { namespace BLAS3 {
+	/*! The bit size of the result is bounded from the row norms of \p A
+	 * and the column norms of \p B, which fixes the number of primes
+	 * before any modular product, see Protected::mulRNS. Entries of
+	 * more than \c LINBOX_MUL_TOOMCOOK_THRESHOLD bits are first split by
+	 * the Toom-Cook method.
+	 */
 	template<class _anyMatrix>
 	_anyMatrix & mul (_anyMatrix& C,
 			  const _anyMatrix& A,
 			  const _anyMatrix& B,
 			  const mulMethod::CRA &)
 	{
+		linbox_check(A.coldim() == B.rowdim());
+		linbox_check(C.rowdim() == A.rowdim() && C.coldim() == B.coldim());
+		if (!C.rowdim() || !C.coldim())
+			return C;
+
+		const double logA = Protected::maxLog2Norm(A, true);
+		const double logB = Protected::maxLog2Norm(B, false);
+		if (logA == -HUGE_VAL || logB == -HUGE_VAL) {
+			for (size_t i = 0 ; i < C.rowdim() ; ++i)
+				for (size_t j = 0 ; j < C.coldim() ; ++j)
+					C.setEntry(i, j, A.field().zero);
+			return C;
+		}
 
-		integer mA, mB ;
-		BlasMatrixDomain<typename _anyMatrix::Field> BMD(A.field());
-		BMD.Magnitude(mA,A);
-		BMD.Magnitude(mB,B);
-		double logC = Givaro::naturallog(mA*mB*A.coldim());
-
-		typedef Givaro::Modular<double> ModularField ;
-
-		{
-
-                        PrimeIterator<IteratorCategories::HeuristicTag> genprime(FieldTraits<ModularField>::bestBitSize(A.coldim()));
-			ChineseRemainder< FullMultipBlasMatCRA< ModularField > > cra( std::pair<size_t,double>(C.rowdim()*C.coldim(), logC) );
-			Protected::IntegerCraMatMul iteration(A,B);
+		// logA and logB are at least the bit sizes of the entries, minus one
+		if (std::max(logA, logB) > LINBOX_MUL_TOOMCOOK_THRESHOLD)
+			return mul(C, A, B, mulMethod::ToomCookSplit());
 
-			cra(C, iteration, genprime);
+		Protected::mulRNS(C, A, B, logA + logB);
 
 #ifdef _LB_DEBUG
-#ifdef _LB_MM_TIMING
-			std::cout << "Sole modular matrix multiplications: " << iteration.chrono << std::endl;
-#endif
-
-			Integer mC; BMD.Magnitude(mC, C);
-			std::cout << "C max: " << logtwo(mC) <<  " (" << LinBox::naturallog(mC) << ')' << std::endl;
+		integer mC;
+		BlasMatrixDomain<typename _anyMatrix::Field> BMD(A.field());
+		BMD.Magnitude(mC, C);
+		std::cout << "C max: " << logtwo(mC) << " (bound " << logA + logB << ')' << std::endl;
 #endif
 
-		}
-
 		return C;
-
 	}
 } // BLAS3
 } // LinBox
@@ -355,6 +355,113 @@ namespace LinBox { namespace BLAS3 {
 
 	}
 
+	namespace Protected {
+
+		//! A = sum_l Al[l] 2^(bl), the limbs having the sign of the entries
+		template<class DenseIntMat>
+		void splitLimbs(std::vector<DenseIntMat> & Al, const DenseIntMat & A, size_t b)
+		{
+			integer x ;
+			for (size_t i = 0 ; i < A.rowdim() ; ++i)
+				for (size_t j = 0 ; j < A.coldim() ; ++j) {
+					x = A.getEntry(i,j) ;
+					for (size_t l = 0 ; l < Al.size() ; ++l) {
+						mpz_tdiv_r_2exp(Al[l].refEntry(i,j).get_mpz(), x.get_mpz_const(), b);
+						mpz_tdiv_q_2exp(x.get_mpz(), x.get_mpz_const(), b);
+					}
+				}
+		}
+
+		//! Ae = sum_l Al[l] z^l, by Horner's rule
+		template<class DenseIntMat>
+		void evalLimbs(DenseIntMat & Ae, const std::vector<DenseIntMat> & Al, long z)
+		{
+			for (size_t i = 0 ; i < Ae.rowdim() ; ++i)
+				for (size_t j = 0 ; j < Ae.coldim() ; ++j) {
+					mpz_ptr x = Ae.refEntry(i,j).get_mpz() ;
+					mpz_set(x, Al.back().getEntry(i,j).get_mpz_const());
+					for (size_t l = Al.size()-1 ; l-- > 0 ; ) {
+						mpz_mul_si(x, x, z);
+						mpz_add(x, x, Al[l].getEntry(i,j).get_mpz_const());
+					}
+				}
+		}
+
+	} // Protected
+
+	template<class DenseIntMat>
+	DenseIntMat & mul (DenseIntMat& C,
+			   const DenseIntMat& A,
+			   const DenseIntMat& B,
+			   const mulMethod::ToomCookSplit & T)
+	{
+		const size_t m = A.rowdim(), k = A.coldim(), n = B.coldim() ;
+		const size_t t = std::max(T.pieces, (size_t)2) ;
+
+		size_t bits = 1 ;
+		for (size_t i = 0 ; i < m ; ++i)
+			for (size_t j = 0 ; j < k ; ++j)
+				bits = std::max(bits, (size_t)A.getEntry(i,j).bitsize());
+		for (size_t i = 0 ; i < k ; ++i)
+			for (size_t j = 0 ; j < n ; ++j)
+				bits = std::max(bits, (size_t)B.getEntry(i,j).bitsize());
+		const size_t b = (bits + t - 1) / t ;
+
+		std::vector<DenseIntMat> Al(t, DenseIntMat(A.field(), m, k)) ;
+		std::vector<DenseIntMat> Bl(t, DenseIntMat(B.field(), k, n)) ;
+		Protected::splitLimbs(Al, A, b);
+		Protected::splitLimbs(Bl, B, b);
+
+		// W[q] = A(z_q) B(z_q), z = 0, 1, -1, 2, -2, ...
+		const size_t d = 2*t - 1 ;
+		std::vector<long> z(d) ;
+		for (size_t q = 1 ; q < d ; ++q)
+			z[q] = (q & 1) ? (long)(q+1)/2 : -(long)(q/2) ;
+		std::vector<DenseIntMat> W(d, DenseIntMat(C.field(), m, n)) ;
+		DenseIntMat Ae(A.field(), m, k), Be(B.field(), k, n) ;
+		for (size_t q = 0 ; q < d ; ++q) {
+			Protected::evalLimbs(Ae, Al, z[q]);
+			Protected::evalLimbs(Be, Bl, z[q]);
+			mul(W[q], Ae, Be, mulMethod::CRA());
+		}
+
+		// Divided differences, then Newton to monomial basis
+		for (size_t r = 1 ; r < d ; ++r)
+			for (size_t q = d-1 ; q >= r ; --q) {
+				const long dz = z[q] - z[q-r] ;
+				for (size_t i = 0 ; i < m ; ++i)
+					for (size_t j = 0 ; j < n ; ++j) {
+						mpz_ptr x = W[q].refEntry(i,j).get_mpz() ;
+						mpz_sub(x, x, W[q-1].getEntry(i,j).get_mpz_const());
+						mpz_divexact_ui(x, x, (unsigned long)std::labs(dz));
+						if (dz < 0) mpz_neg(x, x);
+					}
+			}
+		for (size_t r = d-1 ; r-- > 0 ; )
+			for (size_t q = r ; q < d-1 ; ++q)
+				for (size_t i = 0 ; i < m ; ++i)
+					for (size_t j = 0 ; j < n ; ++j) {
+						mpz_ptr x = W[q].refEntry(i,j).get_mpz() ;
+						mpz_srcptr y = W[q+1].getEntry(i,j).get_mpz_const() ;
+						if (z[r] > 0)
+							mpz_submul_ui(x, y, (unsigned long)z[r]);
+						else
+							mpz_addmul_ui(x, y, (unsigned long)(-z[r]));
+					}
+
+		// C = sum_l W[l] 2^(bl)
+		for (size_t i = 0 ; i < m ; ++i)
+			for (size_t j = 0 ; j < n ; ++j) {
+				mpz_ptr x = C.refEntry(i,j).get_mpz() ;
+				mpz_set(x, W[d-1].getEntry(i,j).get_mpz_const());
+				for (size_t l = d-1 ; l-- > 0 ; ) {
+					mpz_mul_2exp(x, x, b);
+					mpz_add(x, x, W[l].getEntry(i,j).get_mpz_const());
+				}
+			}
+		return C ;
+	}
+
 } // BLAS3
 } // LinBox
 
@@ -59,6 +59,14 @@ namespace LinBox {
 			struct FLINT {};
 
 			struct CRA {} ;
+
+			//! Toom-Cook split of integer entries in \c pieces limbs.
+			struct ToomCookSplit {
+				size_t pieces ;
+				ToomCookSplit(size_t t = 3) :
+					pieces(t)
+				{}
+			} ;
 		}
 	}
 }
@@ -108,6 +116,32 @@ namespace LinBox {
 			 const BlasMatrix<Givaro::Extension<Zpz> >& B,
 			 const mulMethod::ToomCook<Givaro::Extension<Zpz> > & T);
 
+		/** @brief Toom-Cook multiplication of integer matrices.
+		 * Entries of \p A and \p B, of at most \f$tb\f$ bits, are split in
+		 * \f$t\f$ limbs of \f$b\f$ bits, so that \f$A = \sum_l A_l 2^{bl}\f$.
+		 * The matrix polynomials \f$A(z)\f$ and \f$B(z)\f$ are evaluated at
+		 * the \f$2t-1\f$ points \f$0, 1, -1, 2, -2, \dots\f$, multiplied
+		 * there by the multimodular method, and \f$C(z)\f$ is interpolated
+		 * (Newton's divided differences are exact over \f$\mathbf{Z}\f$)
+		 * and evaluated at \f$2^b\f$.
+		 * @param [out] C result
+		 * @param A matrix
+		 * @param B matrix
+		 * @param T number of limbs \f$t\f$
+		 * @return C=AB
+		 */
+		template<class DenseIntMat>
+		DenseIntMat & mul (DenseIntMat& C,
+				   const DenseIntMat& A,
+				   const DenseIntMat& B,
+				   const mulMethod::ToomCookSplit & T);
+
+		template<class DenseIntMat>
+		DenseIntMat & mul (DenseIntMat& C,
+				   const DenseIntMat& A,
+				   const DenseIntMat& B,
+				   const mulMethod::CRA & );
+
 #if 0 /* Generic method */
 		template<class ZpzMatrix>
 		std::vector<ZpzMatrix >& mul (std::vector<ZpzMatrix >& C,
@@ -152,14 +152,22 @@ namespace LinBox
 		};
 
 #ifdef __LINBOX_blas_matrix_multimod_H
+		// each entry is converted once and reduced modulo all the primes
 		template< class IMatrix>
 		class BlasMatrixMAP<MultiModDouble, IMatrix, MatrixContainerCategory::BlasContainer > {
 		public:
 			template<class _Rep>
 			void operator() (BlasMatrix<MultiModDouble,_Rep> &Ap, const IMatrix &A,  MatrixContainerCategory::BlasContainer type)
 			{
-				for (size_t i=0; i<Ap.field().size();++i)
-					MatrixHom::map(Ap.getMatrix(i), A);
+				const MultiModDouble & F = Ap.field();
+				const size_t mn = Ap.planeStride();
+				typename IMatrix::ConstIterator it = A.Begin();
+				integer tmp;
+				for (size_t i=0; i< mn; ++i, ++it){
+					A.field().convert(tmp, *it);
+					for (size_t k=0; k<F.size(); ++k)
+						F.getBase(k).init(Ap.getWritePointer(k)[i], tmp);
+				}
 			}
 		};
 
@@ -169,8 +177,16 @@ namespace LinBox
 			template<class _Rep>
 			void operator() (BlasMatrix<MultiModDouble,_Rep> &Ap, const IMatrix &A,  MatrixContainerCategory::Container type)
 			{
-				for (size_t i=0; i<Ap.field().size();++i)
-					MatrixHom::map(Ap.getMatrix(i), A);
+				const MultiModDouble & F = Ap.field();
+				integer tmp;
+				for( typename IMatrix::ConstIndexedIterator indices = A.IndexedBegin();
+				     (indices != A.IndexedEnd()) ;
+				     ++indices ) {
+					A.field().convert(tmp, A.getEntry(indices.rowIndex(),indices.colIndex()));
+					const size_t ij = indices.rowIndex()*Ap.getStride()+indices.colIndex();
+					for (size_t k=0; k<F.size(); ++k)
+						F.getBase(k).init(Ap.getWritePointer(k)[ij], tmp);
+				}
 			}
 		};
 
@@ -180,8 +196,12 @@ namespace LinBox
 			template<class _Rep>
 			void operator() (BlasMatrix<MultiModDouble,_Rep> &Ap, const IMatrix &A,  MatrixContainerCategory::Blackbox type)
 			{
-				for (size_t i=0; i<Ap.field().size();++i)
-					MatrixHom::map(Ap.getMatrix(i), A);
+				const MultiModDouble & F = Ap.field();
+				for (size_t k=0; k<F.size();++k) {
+					BlasMatrix<Givaro::Modular<double> > Ak(F.getBase(k), A.rowdim(), A.coldim());
+					MatrixHom::map(Ak, A);
+					std::copy(Ak.getPointer(), Ak.getPointer()+Ap.planeStride(), Ap.getWritePointer(k));
+				}
 			}
 		};
 #endif
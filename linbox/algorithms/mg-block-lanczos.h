@@ -39,6 +39,7 @@
 #include "linbox/blackbox/archetype.h"
 #include "linbox/solutions/methods.h"
 #include "linbox/matrix/dense-matrix.h"
+#include "linbox/blackbox/fused-sparse.h"
 
 // I'm putting everything inside the LinBox namespace so that I can drop all of
 // this in to LinBox easily at a later date, without any messy porting.
@@ -143,6 +144,19 @@ namespace LinBox
 				    std::vector<bool> &S,
 				    const Matrix      &T);
 
+		// Apply A to each column of V: AV = A V. A fused normal operator
+		// does it in one sparse x dense block product
+		template <class Blackbox>
+		Matrix &blackboxMul (Matrix &AV, const Blackbox &A, const Matrix &V) const;
+
+		template <class Field1>
+		Matrix &blackboxMul (Matrix &AV, const FusedNormal<Field1> &A, const Matrix &V) const;
+
+		// Inner product C = A^T B of two n x N blocks, as a sum of fgemm
+		// over row chunks of A and B, the chunks being spread over the
+		// threads
+		Matrix &innerProduct (Matrix &C, const Matrix &A, const Matrix &B) const;
+
 		// Given B with N columns and S_i, compute B S_i S_i^T
 		template <class Matrix1, class Matrix2>
 		Matrix1 &mul_SST (Matrix1                 &BSST,
@@ -261,6 +275,9 @@ namespace LinBox
 
 		size_t                    _block;
 
+		// Below this number of entries n x N, inner products are sequential
+		static const size_t InnerProductThreshold = 1 << 16;
+
 		// Construct a transpose matrix on the fly
 		template <class Matrix1>
 		TransposeMatrix<Matrix1> transpose (Matrix1 &M) const
@@ -38,10 +38,15 @@
 #include "linbox/blackbox/compose.h"
 #include "linbox/blackbox/transpose.h"
 #include <givaro/givranditer.h>
+#include <fflas-ffpack/fflas/fflas.h>
 #include "linbox/util/commentator.h"
 #include "linbox/util/timer.h"
 #include "linbox/algorithms/mg-block-lanczos.h"
 
+#ifdef __LINBOX_USE_OPENMP
+#include <omp.h>
+#endif
+
 // I'm putting everything inside the LinBox namespace so that I can drop all of
 // this in to LinBox easily at a later date, without any messy porting.
 
@@ -244,19 +249,13 @@ namespace LinBox
 
 					typedef Diagonal<Field> PC1;
 					typedef Transpose<Blackbox> PC2;
-					typedef Compose<Blackbox, PC1> CO1;
-					typedef Compose<PC1, CO1> CO2;
-					typedef Compose<PC2, CO2> CO3;
-					typedef Compose<PC1, CO3> CO4;
 
 					stream >> d1 >> d2;
 					PC1 D1 (d1);
 					PC1 D2 (d2);
 					PC2 AT (&A);
-					CO1 B1 (&A, &D1);
-					CO2 B2 (&D2, &B1);
-					CO3 B3 (&AT, &B2);
-					CO4 B (&D1, &B3);
+					// D_1 A^T D_2 A D_1, a single sparse operator when A allows it
+					ScaledNormal<Blackbox> B (A, D1, D2);
 
 					report << "Random D_1: ";
 					_VD.write (report, d1) << std::endl;
@@ -269,7 +268,7 @@ namespace LinBox
 					D1.apply (bp, b2);
 
 					_VD.copy (*(_b.colBegin ()), bp);
-					success = iterate (B);
+					success = iterate (B.op ());
 					D1.apply (x, *(_x.colBegin ()));
 
 					break;
@@ -450,20 +449,11 @@ namespace LinBox
 					VectorWrapper::ensureDim (d2, A.rowdim ());
 
 					typedef Diagonal<Field> PC1;
-					typedef Transpose<Blackbox> PC2;
-					typedef Compose<Blackbox, PC1> CO1;
-					typedef Compose<PC1, CO1> CO2;
-					typedef Compose<PC2, CO2> CO3;
-					typedef Compose<PC1, CO3> CO4;
 
 					d_stream >> d1 >> d2;
 					PC1 D1 (field(), d1);
 					PC1 D2 (field(), d2);
-					PC2 AT (&A);
-					CO1 B1 (&A, &D1);
-					CO2 B2 (&D2, &B1);
-					CO3 B3 (&AT, &B2);
-					CO4 B (&D1, &B3);
+					ScaledNormal<Blackbox> B (A, D1, D2);
 
 					report << "Random D_1: ";
 					_VD.write (report, d1) << std::endl;
@@ -477,7 +467,7 @@ namespace LinBox
 					_MD.copy (_b, _x);
 
 					// success =
-					iterate (B);
+					iterate (B.op ());
 
 					_MD.blackboxMulLeft (_b, D1, _x);
 					_MD.copy (_x, _b);
@@ -556,7 +546,7 @@ namespace LinBox
 			stream >> *k;
 
 		TIMER_START(AV);
-		_MD.blackboxMulLeft (_AV, A, _matV[0]);
+		blackboxMul (_AV, A, _matV[0]);
 		TIMER_STOP(AV);
 
 		std::ostream &report = commentator().report (Commentator::LEVEL_IMPORTANT, INTERNAL_DESCRIPTION);
@@ -566,7 +556,7 @@ namespace LinBox
 
 		// Iteration 1
 		TIMER_START(innerProducts);
-		_MD.mul (_VTAV, transpose (_matV[0]), _AV);
+		innerProduct (_VTAV, _matV[0], _AV);
 		TIMER_STOP(innerProducts);
 
 		TIMER_START(Winv);
@@ -601,7 +591,8 @@ namespace LinBox
 		TIMER_STOP(Vnext);
 
 		TIMER_START(innerProducts);
-		mul (_AVTAVSST_VTAV, transpose (_AV), _AV, _vecS);
+		innerProduct (_AVTAVSST_VTAV, _AV, _AV);
+		mul_SST (_AVTAVSST_VTAV, _AVTAVSST_VTAV, _vecS);
 		TIMER_STOP(innerProducts);
 
 		//	MGBLTraceReport (report, _MD, "V", 0, _matV[0]);
@@ -637,7 +628,7 @@ namespace LinBox
 
 		// Iteration 2
 		TIMER_START(AV);
-		_MD.blackboxMulLeft (_AV, A, _matV[1]);
+		blackboxMul (_AV, A, _matV[1]);
 		TIMER_STOP(AV);
 
 #ifdef MGBL_DETAILED_TRACE
@@ -647,7 +638,7 @@ namespace LinBox
 #endif
 
 		TIMER_START(innerProducts);
-		_MD.mul (_VTAV, transpose (_matV[1]), _AV);
+		innerProduct (_VTAV, _matV[1], _AV);
 		TIMER_STOP(innerProducts);
 
 		TIMER_START(Winv);
@@ -679,7 +670,8 @@ namespace LinBox
 		TIMER_STOP(Vnext);
 
 		TIMER_START(innerProducts);
-		mul (_AVTAVSST_VTAV, transpose (_AV), _AV, _vecS);
+		innerProduct (_AVTAVSST_VTAV, _AV, _AV);
+		mul_SST (_AVTAVSST_VTAV, _AVTAVSST_VTAV, _vecS);
 		TIMER_STOP(innerProducts);
 
 		//	MGBLTraceReport (report, _MD, "AV", 1, _AV);
@@ -718,7 +710,7 @@ namespace LinBox
 			if (next_j > 2) next_j = 0;
 
 			TIMER_START(AV);
-			_MD.blackboxMulLeft (_AV, A, _matV[j]);
+			blackboxMul (_AV, A, _matV[j]);
 			TIMER_STOP(AV);
 
 			// First compute F_i+1, where we use Winv_i-2; then Winv_i and
@@ -735,7 +727,7 @@ namespace LinBox
 
 			// Now get the next VTAV, Winv, and S_i
 			TIMER_START(innerProducts);
-			_MD.mul (_VTAV, transpose (_matV[j]), _AV);
+			innerProduct (_VTAV, _matV[j], _AV);
 			TIMER_STOP(innerProducts);
 
 			TIMER_START(Winv);
@@ -778,7 +770,8 @@ namespace LinBox
 
 			// Compute the next _AVTAVSST_VTAV
 			TIMER_START(innerProducts);
-			mul (_AVTAVSST_VTAV, transpose (_AV), _AV, _vecS);
+			innerProduct (_AVTAVSST_VTAV, _AV, _AV);
+			mul_SST (_AVTAVSST_VTAV, _AVTAVSST_VTAV, _vecS);
 			TIMER_STOP(innerProducts);
 
 			MGBLTraceReport (report, _MD, "V^T A^2 V", (size_t)iter, _AVTAVSST_VTAV);
@@ -976,6 +969,75 @@ namespace LinBox
 		return BSST;
 	}
 
+	template <class Field, class Matrix>
+	template <class Blackbox>
+	inline Matrix &MGBlockLanczosSolver<Field, Matrix>::blackboxMul
+	(Matrix         &AV,
+	 const Blackbox &A,
+	 const Matrix   &V) const
+	{
+		return _MD.blackboxMulLeft (AV, A, V);
+	}
+
+	template <class Field, class Matrix>
+	template <class Field1>
+	inline Matrix &MGBlockLanczosSolver<Field, Matrix>::blackboxMul
+	(Matrix                    &AV,
+	 const FusedNormal<Field1> &A,
+	 const Matrix              &V) const
+	{
+		return A.applyBlock (AV, V);
+	}
+
+	template <class Field, class Matrix>
+	inline Matrix &MGBlockLanczosSolver<Field, Matrix>::innerProduct
+	(Matrix       &C,
+	 const Matrix &A,
+	 const Matrix &B) const
+	{
+		linbox_check (A.rowdim () == B.rowdim ());
+		linbox_check (C.rowdim () == A.coldim ());
+		linbox_check (C.coldim () == B.coldim ());
+
+		const size_t n = A.rowdim (), N1 = A.coldim (), N2 = B.coldim ();
+		size_t chunks = 1;
+#ifdef __LINBOX_USE_OPENMP
+		if (n * N1 > InnerProductThreshold)
+			chunks = std::min ((size_t) omp_get_max_threads (), n / std::max (N1, (size_t) 1));
+#endif
+
+		if (chunks <= 1) {
+			FFLAS::fgemm (field (), FFLAS::FflasTrans, FFLAS::FflasNoTrans, N1, N2, n,
+				      field ().one, A.getPointer (), A.getStride (),
+				      B.getPointer (), B.getStride (),
+				      field ().zero, C.getPointer (), C.getStride ());
+			return C;
+		}
+
+		std::vector<std::vector<Element> > part (chunks);
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+		for (long t = 0; t < (long) chunks; ++t) {
+			const size_t r0 = n * (size_t) t / chunks, r1 = n * ((size_t) t + 1) / chunks;
+			part[(size_t) t].resize (N1 * N2);
+			FFLAS::fgemm (field (), FFLAS::FflasTrans, FFLAS::FflasNoTrans, N1, N2, r1 - r0,
+				      field ().one, A.getPointer () + r0 * A.getStride (), A.getStride (),
+				      B.getPointer () + r0 * B.getStride (), B.getStride (),
+				      field ().zero, &part[(size_t) t][0], N2);
+		}
+
+		for (size_t i = 0; i < N1; ++i)
+			for (size_t j = 0; j < N2; ++j) {
+				Element &c = C.refEntry (i, j);
+				field ().assign (c, part[0][i * N2 + j]);
+				for (size_t t = 1; t < chunks; ++t)
+					field ().addin (c, part[t][i * N2 + j]);
+			}
+
+		return C;
+	}
+
 	template <class Field, class Matrix>
 	template <class Matrix1, class Matrix2, class Matrix3>
 	inline Matrix1 &MGBlockLanczosSolver<Field, Matrix>::mul
@@ -29,6 +29,8 @@
 
 #include <iostream>
 #include <cmath>
+#include <vector>
+#include <algorithm>
 
 /*! \file algorithms/minpoly-integer.h
  * Compute the minpoly of a matrix over an integer ring using modular arithmetic
@@ -46,6 +48,10 @@
 #include <fflas-ffpack/ffpack/ffpack.h>
 #include "linbox/algorithms/cra-early-multip.h"
 
+#ifdef __LINBOX_USE_OPENMP
+#include <omp.h>
+#endif
+
 namespace LinBox
 {
 
@@ -94,6 +100,57 @@ namespace LinBox
 
 		template <class Ring>
 		static int minPolyDegreeBlas (const BlasMatrix<Ring>& M, int n_try = 1);
+
+		//! from this order on, minPolyBlas computes its images in parallel
+		static const size_t ParallelThreshold = 256;
+
+		//! bound, in bytes, on the images computed at once, \f$2n^2\f$ elements each
+		static const size_t ImageMemory = (size_t)1 << 30;
+
+		/** Minpoly by blocked Krylov sequences, modulo primes in parallel.
+		 *
+		 * Modulo each prime, the sequence \f$u^TA^iv\f$, \f$i < 2n\f$, is
+		 * computed by baby steps and giant steps: with \f$s \geq \sqrt{2n}\f$ a
+		 * power of 2, \f$V = [v, Av, \ldots, A^{s-1}v]\f$ is built by
+		 * doubling, \f$[V, A^kV]\f$, the powers \f$A^k\f$ being squared up
+		 * to \f$G = A^s\f$; the rows \f$u^TG^j\f$, \f$j < 2n/s\f$, then give all
+		 * the terms at once as \f$(u^TG^j)V\f$. This is \f$\log_2 s\f$
+		 * products of \f$n \times n\f$ matrices, by \c fgemm, and
+		 * \f$O(\sqrt n)\f$ matrix-vector products, instead of \f$2n\f$ of
+		 * them. The minpoly of the sequence is then found by
+		 * Berlekamp/Massey; a degree other than \p degree is a bad prime
+		 * or unlucky projections, and the image is discarded.
+		 * The images are computed as in \c minPolyParallel.
+		 *
+		 * An image costs about \f$2\log_2(s)\,n^3\f$ operations, against
+		 * about \f$n^3\f$, mostly in matrix-vector products, for
+		 * \c FFPACK::MinPoly: it is only faster where \c fgemm runs
+		 * several times faster than these, so \c minPolyBlas does not
+		 * choose it. \c benchmarks/benchmark-minpoly.C compares both.
+		 */
+		template <class Poly, class Ring>
+		static Poly& minPolyBlocked (Poly& y, const BlasMatrix<Ring>& M, int degree);
+
+		template <class Poly, class Ring>
+		static Poly& minPolyBlocked (Poly& y, const BlasMatrix<Ring>& M);
+
+		/** Minpoly from images modulo primes computed concurrently, by
+		 * \c minPolyKrylov if \p blocked, by \c FFPACK::MinPoly otherwise.
+		 * Each round computes as many images as there are threads and as
+		 * fit in \c ImageMemory, see \c concurrentImages, then gives them
+		 * to the CRA in turn.
+		 */
+		template <class Poly, class Ring>
+		static Poly& minPolyParallel (Poly& y, const BlasMatrix<Ring>& M, int degree, bool blocked);
+
+		//! Number of images of an \f$n \times n\f$ matrix computed at once
+		static size_t concurrentImages (size_t n);
+
+		/** Minpoly of a sequence \f$u^TA^iv\f$ for random \f$u, v\f$.
+		 * @param A \f$n \times n\f$ by rows, overwritten
+		 */
+		static std::vector<Element>& minPolyKrylov (std::vector<Element>& poly, const Field& F,
+							    std::vector<Element>& A, size_t n);
 	};
 
 	template<class _Integer, class _Field>
@@ -257,6 +314,9 @@ namespace LinBox
 	Poly& MinPolyBlas<_Integer, _Field>::minPolyBlas (Poly& y, const BlasMatrix<Ring>& M, int degree)
 	{
 
+		if (M. rowdim() >= ParallelThreshold)
+			return minPolyParallel (y, M, degree, false);
+
 		y. resize (degree + 1);
 		size_t n = M. rowdim();
 		PrimeIterator<IteratorCategories::HeuristicTag> primeg(FieldTraits<Field>::bestBitSize(M.coldim()));
@@ -338,6 +398,166 @@ namespace LinBox
 
 		return degree;
 	}
+
+	template <class _Integer, class _Field>
+	template <class Poly, class Ring>
+	Poly& MinPolyBlas<_Integer, _Field>::minPolyBlocked (Poly& y, const BlasMatrix<Ring>& M)
+	{
+		int degree = minPolyDegreeBlas (M);
+		minPolyBlocked (y, M, degree);
+		return y;
+	}
+
+	template <class _Integer, class _Field>
+	template <class Poly, class Ring>
+	Poly& MinPolyBlas<_Integer, _Field>::minPolyBlocked (Poly& y, const BlasMatrix<Ring>& M, int degree)
+	{
+		return minPolyParallel (y, M, degree, true);
+	}
+
+	template <class _Integer, class _Field>
+	size_t MinPolyBlas<_Integer, _Field>::concurrentImages (size_t n)
+	{
+		size_t nt = 1;
+#ifdef __LINBOX_USE_OPENMP
+		nt = (size_t) omp_get_max_threads();
+#endif
+		const size_t image = 2*n*n*sizeof(Element);
+		if (image)
+			nt = std::min(nt, ImageMemory / image);
+		return std::max(nt, (size_t)1);
+	}
+
+	template <class _Integer, class _Field>
+	template <class Poly, class Ring>
+	Poly& MinPolyBlas<_Integer, _Field>::minPolyParallel (Poly& y, const BlasMatrix<Ring>& M, int degree, bool blocked)
+	{
+		y. resize (degree + 1);
+		const size_t n = M. rowdim();
+		PrimeIterator<IteratorCategories::HeuristicTag> primeg(FieldTraits<Field>::bestBitSize(M.coldim()));
+		const size_t nt = concurrentImages (n);
+		std::vector<integer> primes(nt);
+		std::vector<std::vector<Element> > polys(nt);
+
+		EarlyMultipCRA< _Field > cra(3UL);
+		bool first = true;
+		while (first || ! cra. terminated()) {
+			for (size_t t = 0; t < nt; ++ t) {
+				do { ++primeg; }
+				while (cra. noncoprime(*primeg) || std::find(primes. begin(), primes. begin()+t, *primeg) != primes. begin()+t);
+				primes[t] = *primeg;
+			}
+
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads((int)nt)
+#endif
+			for (long t = 0; t < (long)nt; ++ t) {
+				Field F(primes[(size_t)t]);
+				std::vector<Element> FA(n*n);
+				typename BlasMatrix<Ring>::ConstIterator raw_p = M. Begin();
+				for (size_t i = 0; i < n*n; ++ i, ++ raw_p)
+					F. init (FA[i], *raw_p);
+				if (blocked)
+					minPolyKrylov (polys[(size_t)t], F, FA, n);
+				else {
+					std::vector<Element> X(n*(n+1));
+					std::vector<size_t> Perm(n);
+					FFPACK::MinPoly((typename _Field::Father_t) F, polys[(size_t)t], n, &FA[0], n, &X[0], n, &Perm[0]);
+				}
+			}
+
+			for (size_t t = 0; t < nt && (first || ! cra. terminated()); ++ t) {
+				Field F(primes[t]);
+				if (polys[t]. size() != (size_t)degree + 1) {
+					commentator().report (Commentator::LEVEL_IMPORTANT,
+							      INTERNAL_DESCRIPTION) << "Bad prime.\n";
+					continue;
+				}
+				if (first)
+					cra. initialize (F, polys[t]);
+				else
+					cra. progress (F, polys[t]);
+				first = false;
+			}
+		}
+		cra. result (y);
+		return y;
+	}
+
+	template <class _Integer, class _Field>
+	std::vector<typename _Field::Element>&
+	MinPolyBlas<_Integer, _Field>::minPolyKrylov (std::vector<Element>& poly, const Field& F,
+						      std::vector<Element>& A, size_t n)
+	{
+		poly. assign (1, F. one);
+		if (n == 0) return poly;
+		typename Field::RandIter G(F);
+
+		// s baby steps, t giant steps, s t >= L = 2n
+		const size_t L = 2*n;
+		size_t s = 1;
+		while (s*s < L) s <<= 1;
+		const size_t t = (L + s - 1) / s;
+
+		// V = [v, Av, ..., A^(s-1)v] by doubling, P = A^k, then G = A^s;
+		// P and Q are the only n x n temporaries
+		std::vector<Element> V(n*s), Q(n*n);
+		std::vector<Element> & P = A;
+		for (size_t i = 0; i < n; ++ i)
+			G. random (V[i*s]);
+		for (size_t k = 1; k < s; k <<= 1) {
+			FFLAS::fgemm (F, FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, n, k, n,
+				      F. one, &P[0], n, &V[0], s, F. zero, &V[k], s);
+			FFLAS::fgemm (F, FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, n, n, n,
+				      F. one, &P[0], n, &P[0], n, F. zero, &Q[0], n);
+			P. swap (Q);
+		}
+
+		// W = [u^T; u^T G; ...; u^T G^(t-1)], then the terms S = W V
+		std::vector<Element> W(t*n), S(t*s);
+		for (size_t i = 0; i < n; ++ i)
+			G. random (W[i]);
+		for (size_t j = 1; j < t; ++ j)
+			FFLAS::fgemv (F, FFLAS::FflasTrans, n, n, F. one, &P[0], n,
+				      &W[(j-1)*n], 1, F. zero, &W[j*n], 1);
+		FFLAS::fgemm (F, FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, t, s, n,
+			      F. one, &W[0], n, &V[0], s, F. zero, &S[0], s);
+
+		// Berlekamp/Massey on S[0..L-1]: C is the connection polynomial
+		std::vector<Element> C(1, F. one), B(1, F. one), T;
+		size_t l = 0, m = 1;
+		Element b = F. one, d, c;
+		for (size_t N = 0; N < L; ++ N) {
+			F. assign (d, S[N]);
+			for (size_t i = 1; i <= l && i < C. size(); ++ i)
+				F. axpyin (d, C[i], S[N-i]);
+			if (F. isZero (d)) {
+				++ m;
+				continue;
+			}
+			F. div (c, d, b);
+			T = C;
+			if (C. size() < B. size() + m)
+				C. resize (B. size() + m, F. zero);
+			for (size_t i = 0; i < B. size(); ++ i)
+				F. maxpyin (C[i+m], c, B[i]);
+			if (2*l <= N) {
+				l = N + 1 - l;
+				B. swap (T);
+				F. assign (b, d);
+				m = 1;
+			}
+			else
+				++ m;
+		}
+		C. resize (l + 1, F. zero);
+
+		// the minpoly is the reverse of C
+		poly. resize (l + 1);
+		for (size_t k = 0; k <= l; ++ k)
+			F. assign (poly[k], C[l-k]);
+		return poly;
+	}
 } // LinBox
 
 #endif //__LINBOX_minpoly_integer_H
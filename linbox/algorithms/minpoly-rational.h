@@ -37,6 +37,7 @@
 //#include "linbox/algorithms/rational-cra.h"
 #include "linbox/algorithms/rational-reconstruction-base.h"
 #include "linbox/algorithms/classic-rational-reconstruction.h"
+#include "linbox/algorithms/rational-poly-cra-omp.h"
 #include "linbox/solutions/minpoly.h"
 #include "linbox/blackbox/compose.h"
 #include "linbox/blackbox/diagonal.h"
@@ -174,7 +175,7 @@ namespace LinBox
 		std::vector<Integer> M(A.rowdim()+1,1);
 		std::vector<Integer> Di(A.rowdim());
 
-		RationalMatrixFactory<Givaro::ZRing<Integer>,Rationals, BlasMatrix<Rationals > > FA(&A);
+		StreamingRationalMatrixFactory<Rationals> FA(A);
 		Integer da=1, di=1; Integer D=1;
 		FA.denominator(da);
 
@@ -221,6 +222,19 @@ namespace LinBox
 			iteration.setSwitcher(2);
 		}
 
+#ifdef __LINBOX_USE_OPENMP
+		if (omp_get_max_threads() > 1) {
+			Integer den;
+			std::vector<Integer> num;
+			rational_poly_cra_omp<Field>(num, den, iteration, M, genprime);
+			p.resize(num.size());
+			for (size_t i = 0; i < num.size(); ++i)
+				A.field().init(p[i], num[i], den);
+			commentator().stop ("done", NULL, "Iminpoly");
+			return p;
+		}
+#endif
+
 		int k=2;
 		while (! cra(k,PP, iteration, genprime)) {
 			k *=2;
@@ -65,6 +65,7 @@ namespace LinBox
 		template<template<class, class> class Vect, template <class> class Alloc>
 		Vect<Integer, Alloc<Integer> >& result (Vect<Integer, Alloc<Integer> > &num, Integer& den)
 		{
+			this->flush();
 			num.resize( (Father_t::RadixResidues_.front()).size() );
 			std::vector< LazyProduct >::iterator 			_mod_it = Father_t::RadixPrimeProd_.begin();
 			std::vector< std::vector< Integer > >::iterator _tab_it = Father_t::RadixResidues_.begin();
@@ -132,6 +133,7 @@ namespace LinBox
 
 		BlasVector<Givaro::ZRing<Integer> >& result (BlasVector<Givaro::ZRing<Integer>> &num, Integer& den)
 		{
+			this->flush();
 			num.resize( (Father_t::RadixResidues_.front()).size() );
 			std::vector< LazyProduct >::iterator            _mod_it = Father_t::RadixPrimeProd_.begin();
 			std::vector< BlasVector<Givaro::ZRing<Integer>> >::iterator _tab_it = Father_t::RadixResidues_.begin();
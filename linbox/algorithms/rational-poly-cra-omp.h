@@ -0,0 +1,212 @@
+/* linbox/algorithms/rational-poly-cra-omp.h
+ * Copyright (C) 2026 the LinBox group
+ *
+ * ========LICENCE========
+ * This file is part of the library LinBox.
+ *
+ * LinBox is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ */
+
+/*! @file algorithms/rational-poly-cra-omp.h
+ * @ingroup CRA
+ * @brief Task parallel CRA of a rational polynomial, with early termination.
+ */
+
+#ifndef __LINBOX_rational_poly_cra_omp_H
+#define __LINBOX_rational_poly_cra_omp_H
+
+#include <set>
+#include <memory>
+#include <vector>
+#include <utility>
+
+#include "linbox/linbox-config.h"
+#include "linbox/integer.h"
+#include "linbox/util/commentator.h"
+#include "linbox/vector/blas-vector.h"
+#include "linbox/algorithms/cra-full-multip.h"
+#include "linbox/algorithms/rational-reconstruction-base.h"
+#include "linbox/algorithms/classic-rational-reconstruction.h"
+
+#ifdef __LINBOX_USE_OPENMP
+#include <omp.h>
+
+namespace LinBox
+{
+
+	/** \brief Rational polynomial from its images, on all the threads.
+	 *
+	 * \p iteration gives the coefficients \f$c_i M_{o+i}\f$ modulo a
+	 * prime, \f$o\f$ being the number of coefficients missing in the
+	 * image, as in \c MyRationalModularCharpoly or
+	 * \c MyRationalModularMinpoly.
+	 * Every task computes images modulo fresh primes. Whichever task
+	 * finds no reconstruction running takes the new images: each of
+	 * them first checks the last reconstructed polynomial, as it was
+	 * not used to build it, and is then added to the CRA; the
+	 * coefficients are then reconstructed again, and the task goes back
+	 * to computing images. The first agreement stops every task, so
+	 * that the number of primes depends on the actual size of the
+	 * result and not on a bound.
+	 *
+	 * The images of smaller degree than the others (unlucky primes of a
+	 * minimal polynomial) are discarded, and a larger degree restarts
+	 * the CRA.
+	 * @param num, den \f$c_i = num_i/den\f$
+	 */
+	template <class Field, class Function, class PrimeIterator>
+	void rational_poly_cra_omp (std::vector<Integer> & num, Integer & den,
+				    const Function & iteration, const std::vector<Integer> & M,
+				    PrimeIterator & genprime)
+	{
+		typedef std::pair<integer, std::vector<typename Field::Element> > Image;
+
+		std::set<integer> used;
+		std::vector<Image> pending;                // images not yet in the CRA
+		std::unique_ptr< FullMultipCRA<Field> > cra(new FullMultipCRA<Field>);
+		size_t size = 0, count = 0;                // of the images in the CRA
+		std::vector<Integer> cnum;                 // last reconstruction,
+		Integer cden = 0;                          // cden = 0 if none
+		bool busy = false, stop = false;
+		RReconstruction<Givaro::ZRing<Integer>, ClassicMaxQRationalReconstruction<Givaro::ZRing<Integer> > > RR;
+
+		// Whether the candidate agrees with the image
+		auto agrees = [&] (const Image & I) -> bool
+		{
+			Field F(I.first);
+			const size_t o = M.size() - I.second.size();
+			typename Field::Element d, a, b, c;
+			F.init(d, cden);
+			for (size_t i = 0; i < I.second.size(); ++i) {
+				F.init(a, cnum[i]);
+				F.init(b, M[o+i]);
+				F.mul(c, d, I.second[i]);
+				if (!F.areEqual(F.mulin(a, b), c))
+					return false;
+			}
+			return true;
+		};
+
+		// Reconstruct the coefficients from the CRA
+		auto reconstruct = [&] ()
+		{
+			Integer m;
+			std::vector<Integer> PP(size);
+			cra->result(PP);
+			cra->getModulus(m);
+			const size_t o = M.size() - size;
+			for (size_t i = 0; i < size; ++i) {
+				Integer D_1;
+				inv(D_1, M[o+i], m);
+				PP[i] = (PP[i]*D_1) % m;
+			}
+			cnum.resize(size);
+			if (!RR.reconstructRational(cnum, cden, PP, m, -1))
+				cden = 0;
+		};
+
+		const size_t nthreads = (size_t) omp_get_max_threads();
+
+#pragma omp parallel
+#pragma omp single
+		for (size_t t = 0; t < nthreads; ++t) {
+#pragma omp task shared(iteration, M, genprime, used, pending, cra, size, count, cnum, cden, busy, stop, RR)
+			{
+				bool cont = true;
+				while (cont) {
+					integer p;
+#pragma omp critical(rational_poly_cra_omp)
+					{
+						do { ++genprime; } while (used.count(*genprime) || (M[0] % *genprime == 0));
+						p = *genprime;
+						used.insert(p);
+						cont = !stop;
+					}
+					if (!cont) break;
+
+					Field F(p);
+					BlasVector<Field> P(F);
+					iteration(P, F);
+					Image I(p, std::vector<typename Field::Element>(P.begin(), P.end()));
+
+					bool mine;
+#pragma omp critical(rational_poly_cra_omp)
+					{
+						pending.push_back(I);
+						mine = !busy && !stop;
+						if (mine) busy = true;
+					}
+
+					// only one task at a time gets here
+					while (mine) {
+						std::vector<Image> batch;
+#pragma omp critical(rational_poly_cra_omp)
+						{
+							batch.swap(pending);
+							if (batch.empty() || stop)
+								mine = busy = false;
+						}
+						if (!mine) break;
+
+						for (size_t j = 0; j < batch.size() && mine; ++j) {
+							const Image & J = batch[j];
+							Field D(J.first);
+							if (J.second.size() < size)
+								continue;
+							if (J.second.size() > size) {
+								cra.reset(new FullMultipCRA<Field>);
+								size = J.second.size();
+								count = 0;
+								cden = 0;
+							}
+							if (cden != 0 && agrees(J)) {
+#pragma omp critical(rational_poly_cra_omp)
+								{
+									stop = true;
+									mine = busy = false;
+								}
+								break;
+							}
+							if (count++ == 0)
+								cra->initialize(D, J.second);
+							else
+								cra->progress(D, J.second);
+						}
+						if (mine)
+							reconstruct();
+					}
+				}
+			}
+		}
+
+		commentator().report(Commentator::LEVEL_NORMAL, INTERNAL_DESCRIPTION)
+		<< "Primes used " << used.size() << ", in the CRA " << count << std::endl;
+		num.swap(cnum);
+		den = cden;
+	}
+
+}
+
+#endif // __LINBOX_USE_OPENMP
+#endif // __LINBOX_rational_poly_cra_omp_H
+
+// Local Variables:
+// mode: C++
+// tab-width: 4
+// indent-tabs-mode: nil
+// c-basic-offset: 4
+// End:
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
@@ -175,7 +175,7 @@ namespace LinBox
 					if (x_in > 0) res = res && _RR.reconstructRational(a[(size_t)i], new_den,x_in,m);
 					else {
 						res = true;
-						*it_a = 0;
+						a[(size_t)i] = 0;
 						new_den = 1;
 					}
 					if (!res) return res;
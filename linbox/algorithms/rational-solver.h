@@ -33,6 +33,8 @@
 #define __LINBOX_rational_solver_H
 
 #include <iostream>
+#include <random>
+#include <vector>
 
 #include "linbox/linbox-config.h"
 #include "linbox/util/debug.h"
@@ -644,6 +646,12 @@ namespace LinBox
 		mutable RandomPrime             _genprime;
 		mutable Prime                   _prime;
 		Ring                            _ring;
+		mutable std::mt19937_64         _gen;         //!< random combinations of monolithicSolve
+
+		// rows of A of full rank and consistent modulo _basisPrime, found
+		// by the last random monolithicSolve; see randomCombinationSolve
+		mutable Prime                   _basisPrime;
+		mutable std::vector<size_t>     _basisRows;
 #ifdef RSTIMING
 		mutable Timer
 		tSetup,           ttSetup,
@@ -673,7 +681,8 @@ namespace LinBox
 		 */
 		RationalSolver (const Ring& r = Ring(),
 				const RandomPrime& rp = RandomPrime()) :
-			lastCertificate(r, 0), _genprime(rp), _ring(r)
+			lastCertificate(r, 0), _genprime(rp), _ring(r),
+			_gen((uint64_t)BaseTimer::seed())
 		{
             _genprime.setBits(FieldTraits<Field>::bestBitSize());
             _prime=*_genprime; ++_genprime; 
@@ -690,7 +699,8 @@ namespace LinBox
 		 */
 		RationalSolver (const Prime& p, const Ring& r = Ring(),
 				const RandomPrime& rp = RandomPrime()) :
-			lastCertificate(r, 0), _genprime(rp), _prime(p), _ring(r)
+			lastCertificate(r, 0), _genprime(rp), _prime(p), _ring(r),
+			_gen((uint64_t)BaseTimer::seed())
 		{
             _genprime.setBits(FieldTraits<Field>::bestBitSize());
 #ifdef RSTIMING
@@ -814,6 +824,28 @@ namespace LinBox
 						    int maxPrimes = DEFAULT_MAXPRIMES,
 						    const SolverLevel level = SL_DEFAULT) const;
 
+		/** Another random solution of the system last solved by
+		 * <code>monolithicSolve(..., randomSolution = true, ...)</code>.
+		 * The prime and the rows of \c A of full rank found then are
+		 * reused: only the random combination of the columns, its inverse
+		 * and the liftings are computed again.
+		 * No member of the solver is changed, so that several threads can
+		 * call it at once; the certificate of minimal denominator is
+		 * returned in \p cert, \p zbNumer and \p certifiedDenFactor
+		 * instead of \c lastCertificate, \c lastZBNumer and
+		 * \c lastCertifiedDenFactor.
+		 *
+		 * @param rng  random generator of the calling thread
+		 * @return \c SS_OK, or \c SS_FAILED if there is no such system or the solution was wrong.
+		 */
+		template <class IMatrix, class Vector1, class Vector2, class RandomGenerator>
+		SolverReturnStatus randomCombinationSolve (Vector1& num, Integer& den,
+							   VectorFraction<Ring>& cert,
+							   Integer& zbNumer, Integer& certifiedDenFactor,
+							   const IMatrix& A, const Vector2& b,
+							   bool makeMinDenomCert, RandomGenerator& rng,
+							   const SolverLevel level = SL_DEFAULT) const;
+
 		Ring getRing() const
 		{
 			return _ring;
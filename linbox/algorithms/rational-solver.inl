@@ -1026,127 +1026,49 @@ namespace LinBox
 				continue; // try new prime. analogous to u.A12 != A22 in Muld.+Storj.
 			}
 
+			// we now know system is consistent mod p.
+			if (randomSolution) {
+				// the rows of full rank are kept for randomCombinationSolve
+				_basisPrime = _prime;
+				_basisRows.assign(srcRow.begin(), srcRow.begin() + (ptrdiff_t)rank);
+				if (randomCombinationSolve(num, den, lastCertificate, lastZBNumer, lastCertifiedDenFactor,
+							   A, b, makeMinDenomCert, _gen, level) == SS_OK)
+					return SS_OK;
+				_basisRows.clear();
+				continue; // try new prime
+			}
+
 #ifdef RSTIMING
 			tMakeConditioner.start();
 #endif
-			// we now know system is consistent mod p.
 			BlasMatrix<Ring> A_minor(_ring, rank, rank);    // -- will have the full rank minor of A
 			BlasMatrix<Field> *Ap_minor_inv;          // -- will have inverse mod p of A_minor
-			BlasMatrix<Ring> *P = NULL, *B = NULL;   // -- only used in random case
-
-			if (!randomSolution) {
-				// use shortcut - transpose Atp_minor_inv to get Ap_minor_inv
-				Element _rtmp;
-				Ap_minor_inv = Atp_minor_inv;
-				for (size_t i=0; i<rank; ++i)
-					for (size_t j=0; j<i; ++j) {
-						Ap_minor_inv->getEntry(_rtmp, i, j);
-						Ap_minor_inv->setEntry(i, j, Ap_minor_inv->refEntry(j, i));
-						Ap_minor_inv->setEntry(j, i, _rtmp);
-					}
-
-				// permute original entries into A_minor
-				for (size_t i=0; i<rank; ++i)
-					for (size_t j=0; j<rank; ++j)
-						_ring.assign(A_minor.refEntry(i, j), A_check.getEntry(srcRow[i], srcCol[j]));
-#ifdef RSTIMING
-				tMakeConditioner.stop();
-				ttMakeConditioner += tMakeConditioner;
-#endif
-
-				if (makeMinDenomCert && level >= SL_LASVEGAS){
-					B = new BlasMatrix<Ring>(_ring, rank, A.coldim());
-					for (size_t i=0; i<rank; ++i)
-						for (size_t j=0; j<A.coldim(); ++j)
-							_ring.assign(B->refEntry(i, j), A_check.getEntry(srcRow[i],j));
+			BlasMatrix<Ring> *B = NULL;
+
+			// use shortcut - transpose Atp_minor_inv to get Ap_minor_inv
+			Ap_minor_inv = Atp_minor_inv;
+			for (size_t i=0; i<rank; ++i)
+				for (size_t j=0; j<i; ++j) {
+					Element _rtmp;
+					Ap_minor_inv->getEntry(_rtmp, i, j);
+					Ap_minor_inv->setEntry(i, j, Ap_minor_inv->refEntry(j, i));
+					Ap_minor_inv->setEntry(j, i, _rtmp);
 				}
-			}
-			else {
-				P = new BlasMatrix<Ring>(_ring, A.coldim(), rank);
-				B = new BlasMatrix<Ring>(_ring, rank,A.coldim());
-				BlasMatrix<Field> Ap_minor(F, rank, rank);
-				Ap_minor_inv = new BlasMatrix<Field>(F, rank, rank);
-				int nullity;
-
-				LinBox::integer tmp2=0;
-				size_t maxBitSize = 0;
-				for (size_t i=0; i<rank; ++i)
-					for (size_t j=0; j<A.coldim(); ++j){
-						_ring.assign(B->refEntry(i, j), A_check.getEntry(srcRow[i], j));
-						_ring.convert(tmp2, A_check.getEntry(srcRow[i], j));
-						maxBitSize = std::max(maxBitSize, tmp2.bitsize());
-					}
-#ifdef RSTIMING
-				bool firstLoop = true;
-#endif
-				// prepare B to be preconditionned through BLAS matrix mul
-				MatrixApplyDomain<Ring, BlasMatrix<Ring> > MAD(_ring,*B);
-				MAD.setup(2);
 
-				do { // O(1) loops of this preconditioner expected
+			// permute original entries into A_minor
+			for (size_t i=0; i<rank; ++i)
+				for (size_t j=0; j<rank; ++j)
+					_ring.assign(A_minor.refEntry(i, j), A_check.getEntry(srcRow[i], srcCol[j]));
 #ifdef RSTIMING
-					if (firstLoop)
-						firstLoop = false;
-					else
-						tMakeConditioner.start();
-#endif
-					// compute P a n*r random matrix of entry in [0,1]
-					typename BlasMatrix<Ring>::Iterator iter;
-					for (iter = P->Begin(); iter != P->End(); ++iter) {
-						if (rand() > RAND_MAX/2)
-							_ring.assign(*iter, _ring.one);
-						else
-							_ring.assign(*iter, _ring.zero);
-					}
-
-					// compute A_minor = B.P
-#if 0
-					if (maxBitSize * log((double)A.coldim()) > 53)
-						MD.mul(A_minor, *B, *P);
-					else {
-						double *B_dbl= new double[rank*A.coldim()];
-						double *P_dbl= new double[A.coldim()*rank];
-						double *A_minor_dbl = new double[rank*rank];
-						for (size_t i=0;i<rank;++i)
-							for (size_t j=0;j<A.coldim(); ++j){
-								_ring.convert(B_dbl[j+i*A.coldim()], B->getEntry(i,j));
-								_ring.convert(P_dbl[i+j*rank], P->getEntry(j,i));
-							}
-						cblas_dgemm(CblasRowMajor, CblasNoTrans,
-							    CblasNoTrans,
-							    rank, rank, A.coldim(), 1,
-							    B_dbl, A.coldim(), P_dbl, rank, 0,A_minor_dbl, rank);
-
-						for (size_t i=0;i<rank;++i)
-							for (size_t j=0;j<rank;++j)
-								_ring.init(A_minor.refEntry(i,j),A_minor_dbl[j+i*rank]);
-
-						delete[] B_dbl;
-						delete[] P_dbl;
-						delete[] A_minor_dbl;
-					}
+			tMakeConditioner.stop();
+			ttMakeConditioner += tMakeConditioner;
 #endif
 
-					MAD.applyM(A_minor,*P);
-
-
-
-					// set Ap_minor = A_minor mod p, try to compute inverse
-					for (size_t i=0;i<rank;++i)
-						for (size_t j=0;j<rank;++j)
-							F.init(Ap_minor.refEntry(i,j),
-							       _ring.convert(tmp2,A_minor.getEntry(i,j)));
-#ifdef RSTIMING
-					tMakeConditioner.stop();
-					ttMakeConditioner += tMakeConditioner;
-					tInvertBP.start();
-#endif
-					BMDF.inv((BlasMatrix<Field>&)*Ap_minor_inv, (BlasMatrix<Field>&)Ap_minor, nullity);
-#ifdef RSTIMING
-					tInvertBP.stop();
-					ttInvertBP += tInvertBP;
-#endif
-				} while (nullity > 0);
+			if (makeMinDenomCert && level >= SL_LASVEGAS){
+				B = new BlasMatrix<Ring>(_ring, rank, A.coldim());
+				for (size_t i=0; i<rank; ++i)
+					for (size_t j=0; j<A.coldim(); ++j)
+						_ring.assign(B->refEntry(i, j), A_check.getEntry(srcRow[i],j));
 			}
 			// Compute newb = (TAS_P.b)[0..(rank-1)]
 			BlasVector<Ring> newb(b);
@@ -1180,20 +1102,10 @@ namespace LinBox
 			answer_to_vf. numer = short_num;
 			answer_to_vf. denom = short_den;
 
-			if (!randomSolution) {
-				// short_answer = TAS_Q * short_answer
-				answer_to_vf.numer.resize(A.coldim()+1,_ring.zero);
-				BMDI.mulin_left(answer_to_vf.numer, TAS_Qt);
-				answer_to_vf.numer.resize(A.coldim());
-			}
-			else {
-				// short_answer = P * short_answer
-				BlasVector<Ring> newNumer(_ring,A.coldim());
-				BAR.applyV(newNumer, *P, answer_to_vf.numer);
-				//BAR.applyVspecial(newNumer, *P, answer_to_vf.numer);
-
-				answer_to_vf.numer = newNumer;
-			}
+			// short_answer = TAS_Q * short_answer
+			answer_to_vf.numer.resize(A.coldim()+1,_ring.zero);
+			BMDI.mulin_left(answer_to_vf.numer, TAS_Qt);
+			answer_to_vf.numer.resize(A.coldim());
 
 			if (level >= SL_LASVEGAS) { //check consistency
 
@@ -1217,7 +1129,7 @@ namespace LinBox
 
 				if (needNewPrime) {
 					delete Ap_minor_inv;
-					if (randomSolution) {delete P; delete B;}
+					delete B;
 #ifdef RSTIMING
 					tCheckAnswer.stop();
 					ttCheckAnswer += tCheckAnswer;
@@ -1233,7 +1145,7 @@ namespace LinBox
 			tCheckAnswer.stop();
 			ttCheckAnswer += tCheckAnswer;
 #endif
-			if (makeMinDenomCert && level >= SL_LASVEGAS)  // && randomSolution
+			if (makeMinDenomCert && level >= SL_LASVEGAS)
 			{
 				// To make this certificate we solve with the same matrix as to get the
 				// solution, except transposed.
@@ -1281,7 +1193,7 @@ namespace LinBox
 				do {
 					allzero = true;
 					for (q_iter = q.begin(); q_iter != q.end(); ++q_iter) {
-						if (rand() > RAND_MAX/2) {
+						if (_gen() & 1) {
 							_ring.assign((*q_iter), _ring.one);
 							allzero = false;
 						}
@@ -1352,14 +1264,179 @@ namespace LinBox
 			delete Ap_minor_inv;
 			delete B;
 
-			if (randomSolution) {delete P;}
-
 			// done making certificate, lets blow this popstand
 			return SS_OK;
 		}
 		return SS_FAILED; //all primes were bad
 	}
 
+	template <class Ring, class Field, class RandomPrime>
+	template <class IMatrix, class Vector1, class Vector2, class RandomGenerator>
+	SolverReturnStatus
+	RationalSolver<Ring,Field,RandomPrime,DixonTraits>::randomCombinationSolve (Vector1& num,
+										    Integer& den,
+										    VectorFraction<Ring>& cert,
+										    Integer& zbNumer,
+										    Integer& certifiedDenFactor,
+										    const IMatrix& A,
+										    const Vector2& b,
+										    bool makeMinDenomCert,
+										    RandomGenerator& rng,
+										    const SolverLevel level) const
+	{
+		typedef DixonLiftingContainer<Ring, Field,
+			BlasMatrix<Ring>, BlasMatrix<Field> > LiftingContainer;
+
+		const size_t rank = _basisRows.size();
+		if (rank == 0)
+			return SS_FAILED;
+
+		Field F (_basisPrime);
+		BlasMatrixDomain<Field> BMDF(F);
+		BlasApply<Ring> BAR(_ring);
+		VectorDomain<Ring> VDR(_ring);
+
+		BlasMatrix<Ring> A_check(A);
+		BlasMatrix<Ring> A_minor(_ring, rank, rank);    // -- B.P
+		BlasMatrix<Ring> P(_ring, A.coldim(), rank);     // -- random combination of the columns
+		BlasMatrix<Ring> B(_ring, rank, A.coldim());     // -- the rows of full rank of A
+		BlasMatrix<Field> Ap_minor(F, rank, rank);
+		BlasMatrix<Field> Ap_minor_inv(F, rank, rank);  // -- inverse mod p of A_minor
+		int nullity;
+
+		LinBox::integer tmp2=0;
+		for (size_t i=0; i<rank; ++i)
+			for (size_t j=0; j<A.coldim(); ++j)
+				_ring.assign(B.refEntry(i, j), A_check.getEntry(_basisRows[i], j));
+
+		// prepare B to be preconditionned through BLAS matrix mul
+		MatrixApplyDomain<Ring, BlasMatrix<Ring> > MAD(_ring,B);
+		MAD.setup(2);
+
+		do { // O(1) loops of this preconditioner expected
+			// compute P a n*r random matrix of entry in [0,1]
+			typename BlasMatrix<Ring>::Iterator iter;
+			for (iter = P.Begin(); iter != P.End(); ++iter) {
+				if (rng() & 1)
+					_ring.assign(*iter, _ring.one);
+				else
+					_ring.assign(*iter, _ring.zero);
+			}
+
+			// compute A_minor = B.P
+			MAD.applyM(A_minor,P);
+
+			// set Ap_minor = A_minor mod p, try to compute inverse
+			for (size_t i=0;i<rank;++i)
+				for (size_t j=0;j<rank;++j)
+					F.init(Ap_minor.refEntry(i,j),
+					       _ring.convert(tmp2,A_minor.getEntry(i,j)));
+			BMDF.inv(Ap_minor_inv, Ap_minor, nullity);
+		} while (nullity > 0);
+
+		// newb = b restricted to the rows of B
+		BlasVector<Ring> newb(_ring, rank);
+		for (size_t i=0; i<rank; ++i)
+			_ring.assign(newb[i], b[_basisRows[i]]);
+
+		BlasMatrix<Ring>  BBA_minor(A_minor);
+		LiftingContainer lc(_ring, F, BBA_minor, Ap_minor_inv, newb, _basisPrime);
+		RationalReconstruction<LiftingContainer > re(lc);
+
+		Vector1 short_num(_ring,rank); Integer short_den;
+		if (!re.getRational(short_num, short_den,0))
+			return SS_FAILED;
+
+		VectorFraction<Ring> answer_to_vf(_ring, short_num. size());
+		answer_to_vf. numer = short_num;
+		answer_to_vf. denom = short_den;
+
+		// short_answer = P * short_answer
+		BlasVector<Ring> newNumer(_ring,A.coldim());
+		BAR.applyV(newNumer, P, answer_to_vf.numer);
+		answer_to_vf.numer = newNumer;
+
+		if (level >= SL_LASVEGAS) { //check consistency
+			BlasVector<Ring> A_times_xnumer(_ring,b.size());
+			BAR.applyV(A_times_xnumer, A_check, answer_to_vf.numer);
+
+			Integer tmpi;
+			typename Vector2::const_iterator ib = b.begin();
+			typename BlasVector<Ring>::iterator iAx = A_times_xnumer.begin();
+			for (; ib != b.end(); ++iAx, ++ib)
+				if (!_ring.areEqual(_ring.mul(tmpi, *ib, answer_to_vf.denom), *iAx))
+					return SS_FAILED;
+		}
+
+		num = answer_to_vf. numer;
+		den = answer_to_vf. denom;
+
+		if (makeMinDenomCert && level >= SL_LASVEGAS) {
+			// solve with the transpose of the matrix of the solution,
+			// as in monolithicSolve
+			for (size_t i=0; i<rank; ++i)
+				for (size_t j=0; j<i; ++j) {
+					Element _ftmp;
+					Ap_minor_inv.getEntry(_ftmp, i, j);
+					Ap_minor_inv.setEntry(i, j, Ap_minor_inv.refEntry(j, i));
+					Ap_minor_inv.setEntry(j, i, _ftmp);
+					Integer _rtmp;
+					A_minor.getEntry(_rtmp, i, j);
+					A_minor.setEntry(i, j, A_minor.refEntry(j, i));
+					A_minor.setEntry(j, i, _rtmp);
+				}
+
+			//q in {0, 1}^rank
+			BlasVector<Ring> q(_ring,rank);
+			bool allzero;
+			do {
+				allzero = true;
+				for (size_t i=0; i<rank; ++i) {
+					if (rng() & 1) {
+						_ring.assign(q[i], _ring.one);
+						allzero = false;
+					}
+					else
+						_ring.assign(q[i], _ring.zero);
+				}
+			} while (allzero);
+
+			LiftingContainer lc2(_ring, F, A_minor, Ap_minor_inv, q, _basisPrime);
+			RationalReconstruction<LiftingContainer> rere(lc2);
+			Vector1 u_num(_ring,rank); Integer u_den;
+			if (!rere.getRational(u_num, u_den,0)) return SS_FAILED;
+
+			// z <- denom(u . B) * u, moved back to the rows of A
+			VectorFraction<Ring> u_to_vf(_ring, u_num.size());
+			u_to_vf. numer = u_num;
+			u_to_vf. denom = u_den;
+			BlasVector<Ring> uB(_ring,A.coldim());
+			BAR.applyVTrans(uB, B, u_to_vf.numer);
+
+			Integer numergcd = _ring.zero;
+			vectorGcdIn(numergcd, _ring, uB);
+
+			VectorFraction<Ring> z(_ring, b.size());
+			for (size_t i=0; i<rank; ++i)
+				_ring.assign(z.numer[_basisRows[i]], u_to_vf.numer[i]);
+			z.denom = numergcd;
+
+			if (level >= SL_CERTIFIED)
+				cert.copy(z);
+
+			// output new certified denom factor
+			Integer znumer_b, zbgcd;
+			VDR.dotprod(znumer_b, z.numer, b);
+			_ring.gcd(zbgcd, znumer_b, z.denom);
+			_ring.div(certifiedDenFactor, z.denom, zbgcd);
+
+			if (level >= SL_CERTIFIED)
+				_ring.div(zbNumer, znumer_b, zbgcd);
+		}
+
+		return SS_OK;
+	}
+
 
 
 
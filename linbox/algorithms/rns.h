@@ -35,11 +35,87 @@
 #include <givaro/givrns.h> // Chinese Remainder of an array of elements
 
 #include <givaro/givrnsfixed.h>    // Chinese Remainder with fixed primes
+#include <givaro/zring.h>
+
+#include "linbox/randiter/random-prime.h"
+#include "linbox/matrix/dense-matrix.h"
+#include "linbox/matrix/matrixdomain/blas-matrix-domain.h"
 
 
 namespace LinBox
 {
 
+	/*! Conversion of many residue vectors at once from a fixed RNS.
+	 *
+	 * With \f$M_i = M/m_i\f$ and \f$y_i = M_i^{-1} \bmod m_i\f$, the CRT
+	 * gives \f$x = \sum_i |r_i y_i|_{m_i} M_i \bmod M\f$. The \f$M_i\f$ are
+	 * cut in \f$L\f$ digits of \f$w\f$ bits, \f$\Gamma_{l,i}\f$, so that
+	 * for \f$n\f$ values the sums are the \f$L \times n\f$ product
+	 * \f$\Gamma A\f$ over \c Givaro::ZRing<double>, exact as long as
+	 * \f$s 2^{k+w} < 2^{53}\f$ (\f$s\f$ primes of at most \f$k\f$ bits).
+	 * Each column then only needs carries and one reduction modulo
+	 * \f$M\f$. Blocks of columns are processed by different threads.
+	 *
+	 * Only primes of at most 26 bits are handled, see \c usable().
+	 */
+	class RNSBlasConverter {
+	public:
+		typedef Givaro::ZRing<double> Ring;
+
+		RNSBlasConverter() :
+			_size(0), _w(0), _L(0)
+		{}
+
+		template<class Vect>
+		RNSBlasConverter(const Vect & primes)
+		{
+			init(primes);
+		}
+
+		//! precomputes the CRT constants and their digits
+		template<class Vect>
+		void init(const Vect & primes) ;
+
+		//! \c false if the primes are too large or too many for exact products
+		bool usable() const { return _w > 0 ; }
+
+		size_t size() const { return _size; }
+
+		const integer & modulus() const { return _M; }
+
+		/*! \p n values from their residues.
+		 * @param x       output, \c x[j*incx] for \c j < \p n
+		 * @param r       residues, \c r[i*ldr+j] is the \c j-th value mod the \c i-th prime
+		 * @param symmetric if \c true, results are in \f$]-M/2,M/2]\f$, otherwise in \f$[0,M[\f$
+		 */
+		void convert(integer * x, size_t incx, const double * r, size_t n, size_t ldr,
+			     bool symmetric = false) const ;
+
+		/*! Residues of \p n integers, the other way round.
+		 * The \f$|x_j|\f$ are cut in 16 bits digits \f$D_{l,j}\f$, so that the
+		 * residues are the product of the \f$s \times L\f$ matrix of the
+		 * \f$2^{16l} \bmod m_i\f$ by \f$D\f$, done by chunks of digits small
+		 * enough for the sums to be exact.
+		 * @param r       output, \c r[i*ldr+j] is \c x[j*incx] mod the \c i-th prime, in \f$[0,m_i[\f$
+		 * @param x       input, \c x[j*incx] for \c j < \p n
+		 */
+		void reduce(double * r, size_t ldr, const integer * x, size_t incx, size_t n) const ;
+
+	protected:
+		size_t              _size;     //!< number of primes
+		size_t              _w;        //!< bits per digit of the \f$M_i\f$, 0 if unusable
+		size_t              _L;        //!< number of digits
+		std::vector<double> _primes;
+		std::vector<double> _invprimes;
+		std::vector<double> _crt;      //!< \f$y_i\f$
+		std::vector<double> _gamma;    //!< \f$L \times s\f$ digits, row major
+		integer             _M;
+		integer             _midM;
+
+		//! w-bit digits with values below 2^53 to an integer
+		static void _carry(integer & x, const double * c, size_t L, size_t ldc, size_t w) ;
+	};
+
 	/*! RNS.
 	 * Creates a RNS than can recover any number between \c 0 and \c q-1 if
 	 * \c Unsigned=true or \c -q+1 and \c q-1 otherwise (where \c q=2<up>\c
@@ -195,6 +271,8 @@ namespace LinBox
 		void convert(Tinteger & result, Tresidue & residues) ;
 
 		// mixed radix
+	protected:
+		RNSBlasConverter _Conv_ ;
 	};
 
 }
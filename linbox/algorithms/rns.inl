@@ -32,10 +32,200 @@
 #define __LINBOX_algorithms_rns_INL
 
 #include <set>
+#include <cstdint>
+#include <cmath>
 #include "linbox/util/debug.h"
 
 namespace LinBox
 {
+	template<class Vect>
+	void
+	RNSBlasConverter::init(const Vect & primes)
+	{
+		_size = primes.size();
+		_primes.resize(_size);
+		_invprimes.resize(_size);
+		_crt.resize(_size);
+		_M = 1 ;
+		double pmax = 0 ;
+		for (size_t i = 0 ; i < _size ; ++i) {
+			_primes[i] = (double) primes[i] ;
+			_invprimes[i] = 1./_primes[i] ;
+			pmax = std::max(pmax, _primes[i]);
+			Integer::mulin(_M, integer(primes[i]));
+		}
+		Integer::div(_midM, _M, 2);
+
+		// s 2^(k+w) < 2^53
+		const size_t k = (size_t) std::ceil(std::log2(pmax+1));
+		const size_t ls = (size_t) std::ceil(std::log2((double)_size+1));
+		if (k > 26 || k + ls >= 53)
+			_w = 0 ;
+		else
+			_w = std::min((size_t)16, 53 - k - ls) ;
+		if (!_w) return ;
+
+		_L = (_M.bitsize() + _w - 1) / _w ;
+		_gamma.assign(_L*_size, 0.);
+		for (size_t i = 0 ; i < _size ; ++i) {
+			integer p(primes[i]), Mi, yi;
+			Integer::div(Mi, _M, p);
+			inv(yi, Mi % p, p);
+			_crt[i] = (double) yi ;
+			for (size_t l = 0 ; l < _L && Mi > 0 ; ++l) {
+				integer d ;
+				Integer::mod(d, Mi, integer(uint64_t(1) << _w));
+				_gamma[l*_size+i] = (double)(uint64_t) d ;
+				Mi >>= (unsigned long)_w ;
+			}
+			linbox_check(Mi == 0);
+		}
+	}
+
+	inline void
+	RNSBlasConverter::_carry(integer & x, const double * c, size_t L, size_t ldc, size_t w)
+	{
+		const uint64_t mask = (uint64_t(1) << w) - 1 ;
+		std::vector<uint64_t> words ;
+		words.reserve((L*w)/64 + 2);
+		uint64_t carry = 0, cur = 0 ;
+		size_t used = 0 ;
+		for (size_t l = 0 ; l < L || carry ; ++l) {
+			uint64_t acc = carry ;
+			if (l < L) acc += (uint64_t) c[l*ldc] ;
+			const uint64_t digit = acc & mask ;
+			carry = acc >> w ;
+			cur |= digit << used ;
+			used += w ;
+			if (used >= 64) {
+				words.push_back(cur);
+				used -= 64 ;
+				cur = used ? (digit >> (w - used)) : 0 ;
+			}
+		}
+		if (used) words.push_back(cur);
+		if (words.empty()) { x = 0 ; return ; }
+		mpz_import(x.get_mpz(), words.size(), -1, sizeof(uint64_t), 0, 0, &words[0]);
+	}
+
+	inline void
+	RNSBlasConverter::convert(integer * x, size_t incx, const double * r, size_t n, size_t ldr,
+				  bool symmetric) const
+	{
+		linbox_check(usable());
+		Ring ZD ;
+		BlasMatrixDomain<Ring> BMD(ZD);
+		BlasMatrix<Ring> Gamma(ZD, &_gamma[0], _L, _size);
+		BlasMatrix<Ring> A(ZD, _size, n), C(ZD, _L, n);
+
+		// A <- |r y|_m, in [0,m[
+		for (size_t i = 0 ; i < _size ; ++i) {
+			const double p = _primes[i], ip = _invprimes[i], y = _crt[i] ;
+			const double * ri = r + i*ldr ;
+			double * ai = A.getPointer() + i*A.getStride() ;
+			for (size_t j = 0 ; j < n ; ++j) {
+				double a = ri[j]*y ;
+				a -= std::floor(a*ip)*p ;
+				if (a < 0) a += p ;
+				else if (a >= p) a -= p ;
+				ai[j] = a ;
+			}
+		}
+
+		// Blocks stay below the Winograd threshold: plain, exact, dgemm
+		const size_t nb = 256 ;
+		const long nblocks = (long)((n + nb - 1) / nb) ;
+		BlasSubmatrix<BlasMatrix<Ring> > G(Gamma);
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+		for (long b = 0 ; b < nblocks ; ++b) {
+			const size_t j0 = (size_t)b*nb, jn = std::min(nb, n - j0) ;
+			BlasSubmatrix<BlasMatrix<Ring> > Ab(A, 0, j0, _size, jn), Cb(C, 0, j0, _L, jn);
+			BMD.mul(Cb, G, Ab);
+			for (size_t j = j0 ; j < j0 + jn ; ++j) {
+				integer & xj = x[j*incx] ;
+				_carry(xj, C.getPointer() + j, _L, C.getStride(), _w);
+				Integer::modin(xj, _M);
+				if (symmetric && xj > _midM)
+					Integer::subin(xj, _M);
+			}
+		}
+	}
+
+	inline void
+	RNSBlasConverter::reduce(double * r, size_t ldr, const integer * x, size_t incx, size_t n) const
+	{
+		linbox_check(usable());
+		if (!n) return ;
+
+		size_t L = 1 ;
+		for (size_t j = 0 ; j < n ; ++j)
+			L = std::max(L, (x[j*incx].bitsize() + 15) / 16);
+
+		Ring ZD ;
+		BlasMatrixDomain<Ring> BMD(ZD);
+		BlasMatrix<Ring> P(ZD, _size, L), D(ZD, L, n);
+
+		// P_{i,l} = 2^(16 l) mod m_i
+		for (size_t i = 0 ; i < _size ; ++i) {
+			double * pi = P.getPointer() + i*P.getStride() ;
+			pi[0] = 1. ;
+			for (size_t l = 1 ; l < L ; ++l)
+				pi[l] = std::fmod(pi[l-1]*65536., _primes[i]) ;
+		}
+
+		std::vector<bool> negative(n);
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for if (n > 256)
+#endif
+		for (long jj = 0 ; jj < (long)n ; ++jj) {
+			const size_t j = (size_t)jj ;
+			std::vector<uint16_t> digits(L);
+			size_t count = 0 ;
+			mpz_export(&digits[0], &count, -1, sizeof(uint16_t), 0, 0, x[j*incx].get_mpz_const());
+			for (size_t l = 0 ; l < L ; ++l)
+				D.refEntry(l, j) = (l < count) ? (double)digits[l] : 0. ;
+		}
+		for (size_t j = 0 ; j < n ; ++j)
+			negative[j] = (x[j*incx] < 0) ;
+
+		// Chunks of lc digits: lc 2^(26+16) plus a residue stays below 2^53
+		const size_t nb = 256, lc = 256 ;
+		const long nblocks = (long)((n + nb - 1) / nb) ;
+		BlasMatrix<Ring> T(ZD, _size, n);
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+		for (long b = 0 ; b < nblocks ; ++b) {
+			const size_t j0 = (size_t)b*nb, jn = std::min(nb, n - j0) ;
+			BlasSubmatrix<BlasMatrix<Ring> > Tb(T, 0, j0, _size, jn);
+			for (size_t i = 0 ; i < _size ; ++i)
+				for (size_t j = j0 ; j < j0 + jn ; ++j)
+					r[i*ldr+j] = 0. ;
+			for (size_t l0 = 0 ; l0 < L ; l0 += lc) {
+				const size_t ln = std::min(lc, L - l0) ;
+				BlasSubmatrix<BlasMatrix<Ring> > Pc(P, 0, l0, _size, ln), Dc(D, l0, j0, ln, jn);
+				BMD.mul(Tb, Pc, Dc);
+				for (size_t i = 0 ; i < _size ; ++i) {
+					const double p = _primes[i], ip = _invprimes[i] ;
+					const double * ti = T.getPointer() + i*T.getStride() ;
+					for (size_t j = j0 ; j < j0 + jn ; ++j) {
+						double a = r[i*ldr+j] + ti[j] ;
+						a -= std::floor(a*ip)*p ;
+						if (a < 0) a += p ;
+						else if (a >= p) a -= p ;
+						r[i*ldr+j] = a ;
+					}
+				}
+			}
+			for (size_t i = 0 ; i < _size ; ++i)
+				for (size_t j = j0 ; j < j0 + jn ; ++j)
+					if (negative[j] && r[i*ldr+j] != 0.)
+						r[i*ldr+j] = _primes[i] - r[i*ldr+j] ;
+		}
+	}
+
 	/* Constructor */
 	template<bool Unsigned>
 	RNS<Unsigned>::RNS(unsigned long l, unsigned long ps) :
@@ -229,6 +419,7 @@ namespace LinBox
 		}
 		CRTSystemFixed CRT(_Primes_);
 		_CRT_ = CRT;
+		_Conv_.init(_Primes_);
 		return ;
 	}
 
@@ -264,11 +455,26 @@ namespace LinBox
 			residues[i].resize(result.size());
 			unitCRA(residues[i],Givaro::Modular<double>(_Primes_[i]));
 		}
+		cra(result, residues);
+	}
+
+	template<bool Unsigned>
+	void
+	RNSfixed<Unsigned>::cra(std::vector<integer> & result, const std::vector<std::vector<double> > & residues)
+	{
+		const size_t n = result.size();
+		if (_Conv_.usable() && n > 1) {
+			std::vector<double> R(_size_*n);
+			for (size_t i = 0 ; i < _size_ ; ++i)
+				std::copy(residues[i].begin(), residues[i].begin()+(long)n, R.begin()+(long)(i*n));
+			_Conv_.convert(&result[0], 1, &R[0], n, n, !Unsigned);
+			return ;
+		}
 
 		for (size_t i = 0 ; i < result.size() ; ++i) {
 			Prime_t Moduli( _size_ );
 			typename Prime_t::iterator e = Moduli.begin();
-			std::vector<std::vector<double > >::iterator r = residues.begin();
+			std::vector<std::vector<double > >::const_iterator r = residues.begin();
 			for (; e != Moduli.end() ; ++e,++r) {
 				*e = (*r)[i] ;
 			}
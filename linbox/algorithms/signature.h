@@ -25,6 +25,10 @@
 #define __LINBOX_signature_H
 /* Function related to the signature computation of symmetric matrices */
 
+#include <cmath>
+#include <set>
+#include <vector>
+
 #include "linbox/ring/modular.h"
 #include "linbox/algorithms/cra-early-multip.h"
 #include <fflas-ffpack/ffpack/ffpack.h>
@@ -34,6 +38,10 @@
 #include "linbox/polynomial/dense-polynomial.h"
 #include "linbox/solutions/minpoly.h"
 
+#ifdef __LINBOX_USE_OPENMP
+#include <omp.h>
+#endif
+
 namespace LinBox
 {
 
@@ -42,6 +50,8 @@ namespace LinBox
 
 		class BLAS_LPM_Method {};
 		class Minpoly_Method {};
+		//! charpoly modulo primes in parallel, with early exit
+		class Charpoly_Method {};
 
 		template <class Matrix>
 		bool isPosDef (const Matrix& M);
@@ -150,8 +160,222 @@ namespace LinBox
                 else return false;
             }
 
+		template <class Matrix>
+		static bool isPosDef (const Matrix& M, const Charpoly_Method& meth)
+            {
+                return charpolySigns(M, false);
+            }
+
+		template <class Matrix>
+		static bool isPosSemiDef (const Matrix& M, const Charpoly_Method& meth)
+            {
+                return charpolySigns(M, true);
+            }
+
+            /** Floating point test of the positive definiteness of a
+             * symmetric integer matrix, to settle the clear cases.
+             *
+             * The Cholesky factorization \f$R^TR\f$ of \f$A - cI\f$,
+             * \f$c = 2(\gamma/(1-\gamma) + 2u)(1+u)\mathrm{tr}(A)\f$, is
+             * computed in double precision, \f$\gamma = (n+1)u/(1-(n+1)u)\f$.
+             * If it runs to completion, \f$R^TR = A - cI + E + F\f$ where
+             * \f$|E| \leq \gamma|R^T||R|\f$ (Demmel) and the diagonal
+             * \f$F\f$ is the rounding of the shift, so that
+             * \f$\|E+F\|_2 < c\f$ and \f$A\f$ is positive definite.
+             * Otherwise a negative diagonal entry or \f$2\times 2\f$
+             * principal minor (or a zero one, for definiteness) shows
+             * that it is not.
+             * @param semi whether semidefiniteness is asked for.
+             * @return 1 if \p M is positive (semi)definite, 0 if it is
+             * not, -1 if the test does not decide.
+             */
+		template <class Matrix>
+		static int choleskyScreen (const Matrix& M, bool semi)
+            {
+                typedef typename Matrix::Field::Element Int;
+                const typename Matrix::Field& Z = M. field();
+                const size_t n = M. rowdim();
+                std::vector<Integer> A(n*n);
+                Int x;
+                for (size_t i = 0; i < n; ++ i)
+                    for (size_t j = 0; j < n; ++ j)
+                        Z. convert (A[i*n+j], M. getEntry(x, i, j));
+
+                bool exact = (n < (1UL << 20));
+                for (size_t i = 0; i < n; ++ i) {
+                    if (A[i*n+i] < 0 || (!semi && A[i*n+i] == 0))
+                        return 0;
+                    for (size_t j = 0; j < n; ++ j)
+                        if (A[i*n+j]. bitsize() > 53) exact = false;
+                }
+
+                if (exact && cholesky(A, n))
+                    return 1;
+
+                Integer d;
+                for (size_t i = 0; i < n; ++ i)
+                    for (size_t j = i+1; j < n; ++ j) {
+                        d = A[i*n+i] * A[j*n+j] - A[i*n+j] * A[i*n+j];
+                        if (d < 0 || (!semi && d == 0))
+                            return 0;
+                    }
+                return -1;
+            }
+
 	protected:
 
+            // whether the shifted Cholesky factorization of A (entries < 2^53) runs to completion
+		static bool cholesky (const std::vector<Integer>& A, size_t n)
+            {
+                const double u = std::ldexp(1.0, -53), tiny = std::ldexp(1.0, -500);
+                const double g = (double)(n+1) * u / (1 - (double)(n+1) * u);
+                std::vector<double> R(n*n);
+                double tr = 0;
+                for (size_t i = 0; i < n*n; ++ i)
+                    R[i] = (double)A[i];
+                for (size_t i = 0; i < n; ++ i)
+                    tr += R[i*n+i];
+                const double c = 2 * (g / (1 - g) + 2 * u) * (1 + u) * tr;
+                for (size_t i = 0; i < n; ++ i)
+                    R[i*n+i] -= c;
+
+                // right looking, on the upper triangle
+                for (size_t k = 0; k < n; ++ k) {
+                    double* Rk = &R[k*n];
+                    if (!(Rk[k] > 0))
+                        return false;
+                    Rk[k] = std::sqrt(Rk[k]);
+                    for (size_t j = k+1; j < n; ++ j) {
+                        Rk[j] /= Rk[k];
+                        // no underflow in the products below
+                        if (Rk[j] != 0 && std::fabs(Rk[j]) < tiny)
+                            return false;
+                    }
+                    for (size_t i = k+1; i < n; ++ i) {
+                        double* Ri = &R[i*n];
+                        for (size_t j = i; j < n; ++ j)
+                            Ri[j] -= Rk[i] * Rk[j];
+                    }
+                }
+                return true;
+            }
+
+            /* The eigenvalues of the symmetric A are the roots of
+             * det(xI - A) = sum c_k x^k, all real: by Descartes' rule they
+             * are positive (nonnegative) iff (-1)^(n-k) c_k > 0 (>= 0) for
+             * all k. |c_(n-j)| <= binom(n,j) rho^j, rho the largest
+             * absolute row sum, so that the c_k of small n-k are known
+             * after a few primes, and the first of them with a wrong sign
+             * stops the CRA. The others are accepted once the symmetric
+             * residues are unchanged by EarlyTerm primes, as in semiD.
+             * The charpolys modulo as many primes as threads are computed
+             * in parallel at each round.
+             */
+		template <class Matrix>
+		static bool charpolySigns (const Matrix& M, bool semi)
+            {
+                typedef Givaro::Modular<double> Field;
+                typedef Field::Element Element;
+                const size_t EarlyTerm = 3;
+                const size_t n = M. rowdim();
+                if (n == 0) return true;
+
+                std::vector<Integer> A(n*n);
+                typename Matrix::Field::Element x;
+                Integer rho = 0;
+                for (size_t i = 0; i < n; ++ i) {
+                    Integer s = 0;
+                    for (size_t j = 0; j < n; ++ j) {
+                        M. field(). convert (A[i*n+j], M. getEntry(x, i, j));
+                        s += abs(A[i*n+j]);
+                    }
+                    if (s > rho) rho = s;
+                }
+                // bits[k] bounds the size of 2|c_k|
+                std::vector<double> bits(n+1);
+                for (size_t j = 0; j <= n; ++ j)
+                    bits[n-j] = (std::lgamma((double)n+1) - std::lgamma((double)j+1) - std::lgamma((double)(n-j)+1)) / std::log(2.)
+                        + (double)j * (double)rho. bitsize() + 2;
+
+                size_t nt = 1;
+#ifdef __LINBOX_USE_OPENMP
+                nt = (size_t)omp_get_max_threads();
+#endif
+                PrimeIterator<IteratorCategories::HeuristicTag> primeg(FieldTraits<Field>::bestBitSize(n));
+                std::set<integer> used;
+                std::vector<Integer> r(n+1, 0);         // symmetric residues modulo m
+                std::vector<size_t> stable(n+1, 0);
+                Integer m = 1;
+                double mbits = 0;
+
+                while (true) {
+                    std::vector<integer> primes(nt);
+                    for (size_t t = 0; t < nt; ++ t) {
+                        do { ++primeg; } while (used. count(*primeg));
+                        primes[t] = *primeg;
+                        used. insert(primes[t]);
+                    }
+                    std::vector<std::vector<Element> > images(nt);
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+                    for (long t = 0; t < (long)nt; ++ t) {
+                        Field F(primes[(size_t)t]);
+                        BlasMatrix<Field> B(F, n, n);
+                        for (size_t i = 0; i < n; ++ i)
+                            for (size_t j = 0; j < n; ++ j)
+                                F. init (B. refEntry(i, j), A[i*n+j]);
+                        BlasVector<Field> P(F);
+                        BlasMatrixDomain<Field>(F). charpoly(P, B);
+                        images[(size_t)t]. assign(P. begin(), P. end());
+                    }
+
+                    for (size_t t = 0; t < nt; ++ t) {
+                        const Integer p = primes[t];
+                        Field F(p);
+                        Element mi, e;
+                        F. init (mi, m);
+                        F. invin (mi);
+                        const Integer mp = m * p, half = mp / 2;
+                        for (size_t k = 0; k <= n; ++ k) {
+                            F. init (e, r[k]);
+                            F. subin (e, images[t][k]);
+                            F. negin (e);
+                            F. mulin (e, mi);
+                            if (F. isZero(e)) {
+                                ++ stable[k];
+                                continue;
+                            }
+                            stable[k] = 0;
+                            r[k] += m * Integer(e);
+                            if (r[k] > half) r[k] -= mp;
+                        }
+                        m = mp;
+                        mbits += Givaro::logtwo(p);
+
+                        // (-1)^(n-k) c_k, known or stable
+                        bool known = true, early = true;
+                        for (size_t k = 0; k <= n; ++ k) {
+                            const int sg = ((n-k) & 1) ? -sign(r[k]) : sign(r[k]);
+                            const bool good = semi ? (sg >= 0) : (sg > 0);
+                            const bool sure = (mbits > bits[k]);
+                            if (sure && !good)
+                                return false;
+                            known = known && sure;
+                            early = early && (stable[k] >= EarlyTerm);
+                        }
+                        if (known || early) {
+                            for (size_t k = 0; k <= n; ++ k) {
+                                const int sg = ((n-k) & 1) ? -sign(r[k]) : sign(r[k]);
+                                if (semi ? (sg < 0) : (sg <= 0))
+                                    return false;
+                            }
+                            return true;
+                        }
+                    }
+                }
+            }
+
 		template <class Vector>
 		static bool allPos (const Vector& v)
             {
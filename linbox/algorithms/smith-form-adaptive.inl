@@ -36,6 +36,7 @@
 #include "linbox/ring/pir-modular-int32.h"
 #include "linbox/ring/local2_32.h"
 #include "linbox/algorithms/smith-form-iliopoulos.h"
+#include "linbox/algorithms/smith-form-iliopoulos-blas.h"
 #include "linbox/algorithms/smith-form-local.h"
 #include "linbox/algorithms/rational-solver-adaptive.h"
 #include "linbox/algorithms/last-invariant-factor.h"
@@ -125,6 +126,16 @@ namespace LinBox
 				*s_p = 0;
 			report << "      Done\n";
 		}
+		else if (SmithFormIliopoulosBlas::fits((uint64_t)p, (size_t)e)) {
+			report << "      Compute local smith at " << p <<'^' << e << " by blocks over Modular<double>\n";
+			std::vector<size_t> v;
+			SmithFormIliopoulosBlas::local (v, A, (uint64_t)p, (size_t)e);
+			BlasVector<Givaro::ZRing<Integer> >::iterator s_p;
+			std::vector<size_t>::iterator v_p;
+			for (s_p = s. begin(), v_p = v. begin(); s_p != s. begin() +(ptrdiff_t) order; ++ s_p, ++ v_p)
+				*s_p = pow (integer (p), (uint64_t) *v_p);
+			report <<  "      Done\n";
+		}
 		else {
 			report << "      Compute local smith at " << p <<'^' << e << " using PIRModular<int32_t>\n";
 			int64_t m = 1;
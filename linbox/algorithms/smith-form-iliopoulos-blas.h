@@ -0,0 +1,258 @@
+/* linbox/algorithms/smith-form-iliopoulos-blas.h
+ * Copyright (C) 2026 the LinBox group
+ *
+ * ========LICENCE========
+ * This file is part of the library LinBox.
+ *
+ * LinBox is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ */
+
+/*! @file algorithms/smith-form-iliopoulos-blas.h
+ * @ingroup algorithms
+ * @brief Smith form modulo a factored integer by blocks of pivots.
+ */
+
+#ifndef __LINBOX_smith_form_iliopoulos_blas_H
+#define __LINBOX_smith_form_iliopoulos_blas_H
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+#include "linbox/linbox-config.h"
+#include "linbox/integer.h"
+#include "linbox/util/debug.h"
+#include "linbox/field/field-traits.h"
+#include <givaro/modular-double.h>
+#include <fflas-ffpack/fflas/fflas.h>
+#include <fflas-ffpack/ffpack/ffpack.h>
+
+#ifdef __LINBOX_USE_OPENMP
+#include <omp.h>
+#endif
+
+namespace LinBox
+{
+
+	/** \brief Iliopoulos' elimination modulo \f$m\f$, by matrix products.
+	 *
+	 * When \f$m = \prod p_i^{e_i}\f$ is known with every \f$p_i^{e_i}\f$
+	 * small enough for \c Givaro::Modular<double>, the Smith form
+	 * modulo \f$m\f$ is the product of the local Smith forms modulo the
+	 * \f$p_i^{e_i}\f$. Each of them is computed as follows: the rank
+	 * \f$r\f$ of \f$B \bmod p\f$ and its pivots are given by
+	 * \c FFPACK::PLUQ; the pivot block \f$B_{11}\f$ is then a unit
+	 * modulo \f$p^f\f$, its inverse is lifted from \f$p\f$ to \f$p^f\f$
+	 * by Newton iteration, and
+	 * \f$B \sim \mathrm{diag}(I_r, B_{22} - B_{21}B_{11}^{-1}B_{12})\f$,
+	 * where the Schur complement vanishes modulo \f$p\f$. It is divided
+	 * by \f$p\f$ and the same is done modulo \f$p^{f-1}\f$. All the
+	 * pivots of a step are eliminated at once by \c fgemm, instead of
+	 * one row and column operation at a time in SmithFormIliopoulos.
+	 *
+	 * The primes are processed concurrently, and the Schur complement
+	 * update is split into row blocks updated in parallel.
+	 */
+	class SmithFormIliopoulosBlas {
+	public:
+		typedef Givaro::Modular<double> Field;
+		typedef Field::Element          Element;
+
+		//! rows of the Schur complement updated by one task
+		static const size_t BlockRows = 256;
+
+		//! Whether \f$p^e\f$ is small enough for \c Field
+		static bool fits (uint64_t p, size_t e)
+		{
+			uint64_t q = 1, M;
+			FieldTraits<Field>::maxModulus(M);
+			for (size_t i = 0; i < e; ++i) {
+				if (q > M / p) return false;
+				q *= p;
+			}
+			return true;
+		}
+
+		/** Exponents of \f$p\f$ in the invariant factors of \p A modulo \f$p^e\f$.
+		 * @param v set to \f$v_1 \leq \cdots \leq v_k\f$,
+		 * \f$k = \min(m,n)\f$, with \f$v_i = e\f$ for the factors
+		 * which vanish modulo \f$p^e\f$.
+		 * @param A integer matrix, read with \c getEntry.
+		 * @pre <code>fits(p, e)</code>
+		 */
+		template<class Matrix>
+		static std::vector<size_t> & local (std::vector<size_t> & v, const Matrix & A, uint64_t p, size_t e)
+		{
+			linbox_check(fits(p, e));
+			size_t m = A.rowdim(), n = A.coldim();
+			uint64_t q = 1;
+			for (size_t i = 0; i < e; ++i) q *= p;
+
+			v.clear();
+			Field Fq((double)q);
+			std::vector<Element> B(m*n);
+			typename Matrix::Field::Element a;
+			for (size_t i = 0; i < m; ++i)
+				for (size_t j = 0; j < n; ++j)
+					Fq.init(B[i*n+j], A.getEntry(a, i, j));
+
+			for (size_t k = 0; k < e && m && n; ++k) {
+				Field Fp((double)p), F((double)q);
+				const size_t r = _pivots(F, Fp, B, m, n);
+				v.insert(v.end(), r, k);
+				m -= r; n -= r;
+				// B is the Schur complement, divisible by p
+				q /= p;
+				for (size_t i = 0; i < m*n; ++i)
+					B[i] = (Element)((uint64_t)B[i] / p);
+			}
+			v.insert(v.end(), std::min(m, n), e);
+			return v;
+		}
+
+		/** Invariant factors of \p A modulo \f$m = \prod p_i^{e_i}\f$.
+		 * @param s set to the \f$\min(m,n)\f$ diagonal entries of the
+		 * Smith form modulo \f$m\f$, 0 for those divisible by \f$m\f$, as
+		 * by SmithFormIliopoulos::smithFormIn.
+		 * @param factors the pairs \f$(p_i, e_i)\f$.
+		 * @return false, and \p s unchanged, if some \f$p_i^{e_i}\f$ does
+		 * not fit; the generic SmithFormIliopoulos is to be used then.
+		 */
+		template<class Vector, class Matrix>
+		static bool smithForm (Vector & s, const Matrix & A,
+				       const std::vector<std::pair<uint64_t, size_t> > & factors)
+		{
+			const size_t K = factors.size();
+			for (size_t i = 0; i < K; ++i)
+				if (!fits(factors[i].first, factors[i].second))
+					return false;
+
+			std::vector<std::vector<size_t> > v(K);
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+			for (long i = 0; i < (long)K; ++i)
+				local(v[(size_t)i], A, factors[(size_t)i].first, factors[(size_t)i].second);
+
+			const size_t order = std::min(A.rowdim(), A.coldim());
+			integer mod = 1;
+			for (size_t i = 0; i < K; ++i)
+				mod *= pow(integer(factors[i].first), (uint64_t)factors[i].second);
+			s.resize(order);
+			for (size_t j = 0; j < order; ++j) {
+				integer d = 1;
+				for (size_t i = 0; i < K; ++i)
+					d *= pow(integer(factors[i].first), (uint64_t)v[i][j]);
+				A.field().init(s[j], d == mod ? integer(0) : d);
+			}
+			return true;
+		}
+
+	private:
+		/* Rank r of B mod p. B (m x n, mod q = p^f) is replaced by the
+		 * (m-r) x (n-r) Schur complement of a pivot block B11 which is
+		 * a unit mod p, still mod q.
+		 */
+		static size_t _pivots (const Field & F, const Field & Fp, std::vector<Element> & B, size_t m, size_t n)
+		{
+			std::vector<Element> Bp(m*n);
+			for (size_t i = 0; i < m*n; ++i)
+				Fp.init(Bp[i], B[i]);
+			std::vector<size_t> P(m), Q(n);
+			const size_t r = FFPACK::PLUQ(Fp, FFLAS::FflasNonUnit, m, n, &Bp[0], n, &P[0], &Q[0]);
+			if (!r) return 0;
+
+			// P^T B Q^T has the pivots in its leading r x r block
+			std::vector<size_t> rows(m), cols(n);
+			for (size_t i = 0; i < m; ++i) rows[i] = i;
+			for (size_t j = 0; j < n; ++j) cols[j] = j;
+			for (size_t i = 0; i < r; ++i) {
+				std::swap(rows[i], rows[P[i]]);
+				std::swap(cols[i], cols[Q[i]]);
+			}
+			const size_t mr = m-r, nr = n-r;
+			std::vector<Element> B11(r*r), B12(r*nr), B21(mr*r), S(mr*nr);
+			for (size_t i = 0; i < m; ++i) {
+				const Element * Bi = &B[rows[i]*n];
+				for (size_t j = 0; j < n; ++j) {
+					const Element x = Bi[cols[j]];
+					if (i < r) {
+						if (j < r) B11[i*r+j] = x; else B12[i*nr+j-r] = x;
+					}
+					else {
+						if (j < r) B21[(i-r)*r+j] = x; else S[(i-r)*nr+j-r] = x;
+					}
+				}
+			}
+
+			std::vector<Element> X(r*r);
+			_inverse(F, Fp, X, B11, r);
+			if (mr && nr) {
+				// Y = B11^-1 B12, then S = B22 - B21 Y by row blocks
+				std::vector<Element> Y(r*nr);
+				FFLAS::fgemm(F, FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, r, nr, r,
+					     F.one, &X[0], r, &B12[0], nr, F.zero, &Y[0], nr);
+				const long nb = (long)((mr + BlockRows - 1) / BlockRows);
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+				for (long b = 0; b < nb; ++b) {
+					const size_t i0 = (size_t)b * BlockRows, h = std::min((size_t)BlockRows, mr - i0);
+					FFLAS::fgemm(F, FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, h, nr, r,
+						     F.mOne, &B21[i0*r], r, &Y[0], nr, F.one, &S[i0*nr], nr);
+				}
+			}
+			B.swap(S);
+			return r;
+		}
+
+		/* X = B11^-1 mod q, from its inverse mod p by Newton iteration
+		 * X <- X (2I - B11 X), which doubles the precision each time.
+		 */
+		static void _inverse (const Field & F, const Field & Fp, std::vector<Element> & X,
+				      const std::vector<Element> & B11, size_t r)
+		{
+			std::vector<Element> A(r*r), T(r*r), Z(r*r);
+			for (size_t i = 0; i < r*r; ++i)
+				Fp.init(A[i], B11[i]);
+			int nullity;
+			FFPACK::Invert(Fp, r, &A[0], r, &X[0], r, nullity);
+			linbox_check(!nullity);
+			for (uint64_t pk = (uint64_t)Fp.characteristic(); pk < (uint64_t)F.characteristic(); pk *= pk) {
+				// T = I - B11 X, X <- X + X T
+				for (size_t i = 0; i < r*r; ++i) T[i] = F.zero;
+				for (size_t i = 0; i < r; ++i) T[i*r+i] = F.one;
+				FFLAS::fgemm(F, FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, r, r, r,
+					     F.mOne, &B11[0], r, &X[0], r, F.one, &T[0], r);
+				Z = X;
+				FFLAS::fgemm(F, FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, r, r, r,
+					     F.one, &X[0], r, &T[0], r, F.one, &Z[0], r);
+				X.swap(Z);
+			}
+		}
+	};
+
+}
+
+#endif //__LINBOX_smith_form_iliopoulos_blas_H
+
+// Local Variables:
+// mode: C++
+// tab-width: 4
+// indent-tabs-mode: nil
+// c-basic-offset: 4
+// End:
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
@@ -41,6 +41,7 @@ namespace LinBox
 	 * <i>Worst Case Complexity Bounds on Algorithms for computing the Canonical
 	 *  Structure of Finite Abelian Groups and the Hermite and Smith Normal
 	 * Forms of an Integer Matrix</i>, by Costas Iliopoulos.
+	 * @see SmithFormIliopoulosBlas when the factorization of m is known.
 	 */
 
 	class SmithFormIliopoulos{
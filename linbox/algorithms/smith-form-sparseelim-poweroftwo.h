@@ -25,9 +25,17 @@
 #ifndef __LINBOX_pp_gauss_poweroftwo_H
 #define __LINBOX_pp_gauss_poweroftwo_H
 #include <map>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <type_traits>
 #include <givaro/givconfig.h> // for Signed_Trait
 #include "linbox/algorithms/smith-form-sparseelim-local.h"
 
+#ifdef __LINBOX_USE_OPENMP
+#include <omp.h>
+#endif
+
 #ifdef DEBUG
 #  ifndef LINBOX_pp_gauss_intermediate_OUT
 #    define LINBOX_pp_gauss_intermediate_OUT
@@ -56,23 +64,33 @@ namespace LinBox
         /** \brief Repository of functions for rank modulo 
          * a prime power by elimination on sparse matrices.
          * Specialization for powers of 2
+         *
+         * With a native unsigned integer type (2^k, k <= 64), the
+         * elimination switches to a dense array once the remaining rows
+         * are dense enough: the row updates are then plain loops over
+         * words, independent from one row to the other, run in parallel
+         * with OpenMP.
          */
     template<typename UnsignedIntType>
     class PowerGaussDomainPowerOfTwo  {
         typedef UnsignedIntType UInt_t;
         typedef UnsignedIntType Element;
+        typedef std::integral_constant<bool, std::is_integral<UInt_t>::value> IsNative;
         const Element zero;
         const Element one;
+        size_t _denseMinDim;
     public:
 
             /** \brief The field parameter is the domain
              * over which to perform computations
+             * @param denseMinDim smallest dimensions of the remaining
+             * submatrix for the switch to dense elimination, 0 for never.
              */
-        PowerGaussDomainPowerOfTwo () : zero(0U), one(1U) {}
+        PowerGaussDomainPowerOfTwo (size_t denseMinDim = 256) : zero(0U), one(1U), _denseMinDim(denseMinDim) {}
 
             //Copy constructor
             ///
-        PowerGaussDomainPowerOfTwo (const PowerGaussDomainPowerOfTwo &M) {}
+        PowerGaussDomainPowerOfTwo (const PowerGaussDomainPowerOfTwo &M) : zero(0U), one(1U), _denseMinDim(M._denseMinDim) {}
 
 
 
@@ -95,7 +113,7 @@ namespace LinBox
             //  IEEE Transactions on Computers, 2013]  
             // http://doi.ieeecomputersociety.org/10.1109/TC.2013.94
         UInt_t& MY_Zpz_inv (UInt_t& u1, const UInt_t& a, const size_t exponent, const UInt_t& TWOTOEXPMONE) const {
-            static const UInt_t ttep2(TWOTOEXPMONE+3U);
+            const UInt_t ttep2(TWOTOEXPMONE+3U);
             if (this->isOne(a)) return u1=this->one;
             REQUIRE( (one<<exponent) == (TWOTOEXPMONE+1U) );
             REQUIRE( a <= TWOTOEXPMONE );
@@ -349,6 +367,156 @@ namespace LinBox
             }
         }
 
+
+            // ------------------------------------------------------
+            // Dense elimination of the remaining rows, native words
+            // ------------------------------------------------------
+
+            // 2-adic valuation of a nonzero word
+        static size_t Valuation(UInt_t a) {
+#ifdef __GNUC__
+            return (size_t)__builtin_ctzll((unsigned long long)a);
+#else
+            size_t v(0);
+            for( ; !(a & 1U); a >>= 1) ++v;
+            return v;
+#endif
+        }
+
+            // Valuation of the gcd of the entries of rows k.., none of them odd
+        template<class BB>
+        size_t CommonValuation(const BB& LigneA, const unsigned long k, const size_t Ni, std::true_type) const {
+            UInt_t all(zero);
+            for(size_t l=k; l<Ni; ++l)
+                for(auto const& iter : LigneA[l]) all |= iter.second;
+            return this->isZero(all) ? 1 : Valuation(all);
+        }
+
+        template<class BB>
+        size_t CommonValuation(const BB&, const unsigned long, const size_t, std::false_type) const {
+            return 1;
+        }
+
+            // Remaining rows k.. at least one quarter full
+        template<class BB>
+        bool SwitchToDense(const BB& LigneA, const unsigned long k, const size_t Ni, const size_t Nj, const unsigned long indcol, std::true_type) const {
+            if (!_denseMinDim || (Ni-k < _denseMinDim) || (Nj-indcol < _denseMinDim))
+                return false;
+            size_t nnz(0);
+            for(size_t l=k; l<Ni; ++l) nnz += LigneA[l].size();
+            return 4*nnz >= (Ni-k)*(Nj-indcol);
+        }
+
+        template<class BB>
+        bool SwitchToDense(const BB&, const unsigned long, const size_t, const size_t, const unsigned long, std::false_type) const {
+            return false;
+        }
+
+            /** Ends the elimination of rows k.. of LigneA, whose entries
+             * are in the columns indcol.., in a dense array.
+             * The pivot is the first odd entry, if none every row is divided
+             * by the largest power of two dividing all the entries.
+             */
+        template<class BB, class Container, class Perm, class PreserveTrait>
+        void DenseElimination(size_t EXPONENT, Container& ranks, BB& LigneA, Perm& Q,
+                              const unsigned long k, const size_t Ni, const size_t Nj,
+                              unsigned long indcol, PreserveTrait preserve, std::true_type) {
+            typedef typename BB::Row Vecteur;
+            const size_t m(Ni-k), n(Nj-indcol), j0(indcol);
+            const size_t digits( std::numeric_limits<UInt_t>::digits );
+            UInt_t mask( EXPONENT >= digits ? UInt_t(~UInt_t(0U)) : UInt_t((UInt_t(1U) << EXPONENT) - 1U) );
+
+#ifdef  LINBOX_pp_gauss_steps_OUT
+            std::cerr << "------------ dense elimination of rows " << k << ".. (" << m << 'x' << n << ") ---" << std::endl;
+#endif
+
+            std::vector<UInt_t> D(m*n, zero);
+            for(size_t i=0; i<m; ++i) {
+                for(auto const& iter : LigneA[k+i]) {
+                    REQUIRE( iter.first >= j0 );
+                    D[i*n+(iter.first-j0)] = iter.second;
+                }
+                LigneA[k+i] = Vecteur(0);
+            }
+
+            size_t r(0);
+            while( (r < m) && (r < n) ) {
+                    // Look for an odd pivot
+                size_t pi(r), pj(n);
+                for( ; pi<m; ++pi) {
+                    const UInt_t * Di = &D[pi*n];
+                    for(pj=r; pj<n; ++pj)
+                        if (Di[pj] & 1U) break;
+                    if (pj < n) break;
+                }
+
+                if (pi == m) {
+                        // None: divide by the common power of 2
+                    UInt_t all(zero);
+                    for(size_t l=r*n; l<m*n; ++l) all |= D[l];
+                    if (this->isZero(all)) break;
+                    const size_t v( Valuation(all) );
+                    for(size_t l=r*n; l<m*n; ++l) D[l] >>= v;
+                    for(size_t t=0; t<v; ++t) ranks.push_back( indcol );
+                    EXPONENT -= v;
+                    mask >>= v;
+#ifdef LINBOX_PRANK_OUT
+                    std::cerr << "Rank mod 2^" << (ranks.size()) << " : " << indcol << std::endl;
+#endif
+                    continue;
+                }
+
+                if (pi != r)
+                    std::swap_ranges(D.begin()+(ptrdiff_t)(pi*n), D.begin()+(ptrdiff_t)(pi*n+n), D.begin()+(ptrdiff_t)(r*n));
+                if (pj != r) {
+                    for(size_t i=0; i<m; ++i)
+                        std::swap(D[i*n+r], D[i*n+pj]);
+                    Q.permute(j0+r, j0+pj);
+                    PermuteUpperMatrix(LigneA, k, j0+r, (long)(j0+pj), preserve);
+                }
+
+                UInt_t invpiv;
+                MY_Zpz_inv(invpiv, D[r*n+r], EXPONENT, mask);
+                ++indcol;
+
+                    // D_i <-- D_i - D_ir/D_rr D_r, for all i > r
+                const UInt_t * Dr = &D[r*n];
+                const long first((long)r+1), last((long)m);
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for schedule(static) if ((m-r)*(n-r) >= 1<<16)
+#endif
+                for(long i=first; i<last; ++i) {
+                    UInt_t * Di = &D[(size_t)i*n];
+                    if (this->isZero(Di[r])) continue;
+                    const UInt_t h( UInt_t(UInt_t(zero - Di[r]) * invpiv) & mask );
+                    for(size_t j=r; j<n; ++j)
+                        Di[j] = UInt_t(Di[j] + h * Dr[j]) & mask;
+                }
+                ++r;
+            }
+
+                // Remaining ranks
+            for( ; EXPONENT; --EXPONENT)
+                ranks.push_back( indcol );
+
+                // Pivot rows back in LigneA, the other ones are zero
+            for(size_t i=0; i<r; ++i) {
+                Vecteur ligne;
+                for(size_t j=i; j<n; ++j)
+                    if (this->isNZero(D[i*n+j])) ligne.emplace_back(j0+j, D[i*n+j]);
+                LigneA[k+i] = ligne;
+                PreserveUpperMatrixRow(LigneA[k+i], preserve);
+            }
+
+#ifdef LINBOX_PRANK_OUT
+            std::cerr << "Rank mod 2^" << ranks.size() << " : " << indcol << std::endl;
+#endif
+        }
+
+        template<class BB, class Container, class Perm, class PreserveTrait>
+        void DenseElimination(size_t, Container&, BB&, Perm&, const unsigned long, const size_t, const size_t,
+                              unsigned long, PreserveTrait, std::false_type) {}
+
             // ------------------------------------------------------
             // Rank calculators, defining row strategy
             // ------------------------------------------------------
@@ -404,6 +572,12 @@ namespace LinBox
                 for (unsigned long k=0; k<last;++k) {
                     if ( ! (k % maxout) ) commentator().progress ((long)k);
 
+                    if (SwitchToDense(LigneA, k, Ni, Nj, indcol, IsNative())) {
+                        DenseElimination(EXPONENT, ranks, LigneA, Q, k, Ni, Nj, indcol, typename Boolean_Trait<PreserveUpperMatrix>::BooleanType(), IsNative());
+                        commentator().stop ("done", 0, "PRGEPo2");
+                        return;
+                    }
+
                         // Look for invertible pivot
                     unsigned long p=k;
                     for(;;) {
@@ -432,24 +606,27 @@ namespace LinBox
                         if (c > -2) break;
 
                             // No invertible pivot found
-                            // reduce everything by one power of 2
+                            // reduce everything by the common power of 2
+                        const size_t v( CommonValuation(LigneA, k, Ni, IsNative()) );
                         for(unsigned long ii=k;ii<Ni;++ii)
                             for(unsigned long jjj=LigneA[(size_t)ii].size();jjj--;)
-                                LigneA[(size_t)ii][(size_t)jjj].second >>= 1;
+                                LigneA[(size_t)ii][(size_t)jjj].second >>= v;
 
-                        --EXPONENT;
-                        TWOK >>= 1;
-                        TWOKMONE >>=1;
+                        for(size_t t=0; t<v; ++t) {
+                            --EXPONENT;
+                            TWOK >>= 1;
+                            TWOKMONE >>=1;
 
-                        ENSURE( TWOK == (UInt_t(1U) << EXPONENT) );
-                        ENSURE( TWOKMONE == (TWOK - 1U) );
+                            ENSURE( TWOK == (UInt_t(1U) << EXPONENT) );
+                            ENSURE( TWOKMONE == (TWOK - 1U) );
 
-                        ranks.push_back( indcol );
-                        ++ind_pow;
+                            ranks.push_back( indcol );
+                            ++ind_pow;
 #ifdef LINBOX_PRANK_OUT
-                        std::cerr << "Rank mod 2^" << ind_pow << " : " << indcol << std::endl;
-                        if (TWOK == 1) std::cerr << "wattadayada inhere ?" << std::endl;
+                            std::cerr << "Rank mod 2^" << ind_pow << " : " << indcol << std::endl;
+                            if (TWOK == 1) std::cerr << "wattadayada inhere ?" << std::endl;
 #endif
+                        }
 
                     }
                     if (p != k) {
@@ -24,6 +24,8 @@
 #ifndef __LINBOX_toeplitz_det_H
 #define __LINBOX_toeplitz_det_H
 
+#include <vector>
+
 namespace LinBox
 { // namespace in which all LinBox code resides.
 
@@ -69,6 +71,74 @@ namespace LinBox
 		return res;
 	}
 
+	/** Determinant of the \f$n \times n\f$ Toeplitz matrix with entries
+	 * \f$T_{n-1+i-j}\f$, by the same Euclidean algorithm on dense
+	 * coefficient vectors, so that no polynomial ring is needed.
+	 * @param T the \f$2n-1\f$ coefficients
+	 */
+	template< class Field >
+	typename Field::Element& toeplitz_determinant
+	( const Field& F, typename Field::Element& res,
+	  const std::vector<typename Field::Element>& T, size_t n )
+	{
+		typedef typename Field::Element Element;
+		typedef std::vector<Element> Poly;
+		// degree, -1 for the zero polynomial
+		auto deg = [&F] (const Poly& f) -> long {
+			long d = (long)f.size() - 1;
+			while (d >= 0 && F.isZero(f[(size_t)d])) --d;
+			return d;
+		};
+		// r *= a^e
+		auto mulpow = [&F] (Element& r, const Element& a, long e) {
+			Element b(a);
+			for (; e > 0; e >>= 1) {
+				if (e & 1) F.mulin(r, b);
+				F.mulin(b, b);
+			}
+		};
+
+		short int sign = 1;
+		Element temp;
+		F.assign(res, F.one);
+		if (n == 0) return res;
+		Poly f1(2*n, F.zero), f2(T), fi;
+		F.assign(f1[2*n-1], F.one);
+		f2.resize((size_t)deg(f2)+1);
+
+		while( deg(f2) >= (long)n ) {
+			// fi = f1 mod f2
+			const long d2 = deg(f2);
+			Element lc;
+			F.inv(lc, f2[(size_t)d2]);
+			fi = f1;
+			for (long k = deg(fi); k >= d2; --k) {
+				F.mul(temp, fi[(size_t)k], lc);
+				if (F.isZero(temp)) continue;
+				for (long i = 0; i <= d2; ++i)
+					F.maxpyin(fi[(size_t)(k-d2+i)], temp, f2[(size_t)i]);
+			}
+			fi.resize((size_t)d2);
+			fi.resize((size_t)(deg(fi)+1));
+
+			const long d1 = deg(f1);
+			mulpow( res, f2[(size_t)d2], d1 - deg(fi) );
+			if( !((d2-d1)%2) && !((d1-(long)n)%2) )
+				sign = (short)-sign;
+			f1.swap(f2);
+			f2.swap(fi);
+		}
+
+		if( deg(f2) == (long)n-1 ) {
+			mulpow( res, f2[n-1], deg(f1) - deg(f2) );
+			if( sign == -1 )
+				F.negin(res);
+		}
+		else F.assign( res, F.zero );
+
+		return res;
+	}
+
 } // end of namespace LinBox
 
 #endif //__LINBOX_toeplitz_det_H
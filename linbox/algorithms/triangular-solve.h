@@ -27,6 +27,14 @@
 #define __LINBOX_triangular_solve_H
 
 #include "linbox/vector/vector-domain.h"
+#include "linbox/linbox-tags.h"
+
+#include <vector>
+#include <algorithm>
+
+#ifdef __LINBOX_USE_OPENMP
+#include <omp.h>
+#endif
 
 namespace LinBox
 {
@@ -202,6 +210,207 @@ namespace LinBox
 		commentator().stop ("done", NULL, "ltrsm");
 		return x;
 	}
+
+	/** \brief Sparse triangular solver, analysed once for many solves.
+	 *
+	 * The rows of the triangular matrix are sorted in level sets: the
+	 * rows of level 0 depend on no other unknown, those of level
+	 * \f$k\f$ only on unknowns of levels \f$< k\f$. Each level is then
+	 * solved at once, its rows in parallel. The matrix is copied in a
+	 * compressed row form at construction, so that the analysis is
+	 * reused by every subsequent solve, for instance in the p-adic
+	 * lifting of @ref SparseLULiftingContainer.
+	 *
+	 * Solves with \c Tag::Shape::Lower are those of
+	 * \c lowerTriangularUnitarySolve (the diagonal, if stored, is
+	 * ignored) and with \c Tag::Shape::Upper those of
+	 * \c upperTriangularSolve: the first entry of a nonempty row is its
+	 * pivot, the unknowns past the last nonempty row are read from \p x
+	 * and the system must be consistent.
+	 */
+	template <class _Field>
+	class SparseTriangularSolver {
+	public:
+		typedef _Field                  Field;
+		typedef typename Field::Element Element;
+
+		//! Below this number of rows, a level is solved sequentially
+		static const size_t ParallelThreshold = 64;
+
+		/** Analyse a sparse triangular matrix.
+		 * @param T a sparse matrix whose rows are sequences of (index, value) pairs
+		 * @param shape \c Tag::Shape::Lower (unit) or \c Tag::Shape::Upper
+		 */
+		template <class _Matrix>
+		SparseTriangularSolver (const _Matrix &T, const LINBOX_enum(Tag::Shape) shape) :
+			_field(&T.field()), _lower(shape == Tag::Shape::Lower), _nrows(0), _start(1, 0)
+		{
+			const Field &F = field();
+			typename _Matrix::ConstRowIterator row;
+
+			// for U, the rows past the last nonempty row are only checked
+			if (_lower)
+				_nrows = T.rowdim();
+			else {
+				size_t i = 0;
+				for (row = T.rowBegin(); row != T.rowEnd(); ++row, ++i)
+					if (row->size()) _nrows = i+1;
+			}
+
+			_inv.resize(_nrows, F.zero);
+			_empty.resize(_nrows, false);
+			size_t i = 0;
+			for (row = T.rowBegin(); i < _nrows; ++row, ++i) {
+				typename _Matrix::Row::const_iterator it = row->begin();
+				if (!_lower) {
+					if (row->size())
+						F.inv(_inv[i], (it++)->second);
+					else
+						_empty[i] = true;
+				}
+				for ( ; it != row->end(); ++it)
+					if ((_lower && it->first < i) || (!_lower && it->first > i)) {
+						_col.push_back(it->first);
+						_val.push_back(it->second);
+					}
+				_start.push_back(_col.size());
+			}
+
+			// level of each row, then rows sorted by level
+			std::vector<size_t> level(_nrows, 0);
+			size_t nlevels = _nrows ? 1 : 0;
+			for (size_t k = 0; k < _nrows; ++k) {
+				const size_t r = _lower ? k : _nrows-1-k;
+				for (size_t j = _start[r]; j < _start[r+1]; ++j)
+					if (_col[j] < _nrows)
+						level[r] = std::max(level[r], level[_col[j]]+1);
+				nlevels = std::max(nlevels, level[r]+1);
+			}
+			_levelStart.assign(nlevels+1, 0);
+			for (size_t r = 0; r < _nrows; ++r)
+				++_levelStart[level[r]+1];
+			for (size_t l = 0; l < nlevels; ++l)
+				_levelStart[l+1] += _levelStart[l];
+			_order.resize(_nrows);
+			std::vector<size_t> pos(_levelStart.begin(), _levelStart.end()-1);
+			for (size_t r = 0; r < _nrows; ++r)
+				_order[pos[level[r]]++] = r;
+		}
+
+		//! Number of level sets, i.e. of sequential steps of a solve
+		size_t levels () const { return _levelStart.size()-1; }
+
+		const Field &field () const { return *_field; }
+
+		/** Solve \f$Tx = b\f$.
+		 * @param x solution; with \c Tag::Shape::Upper, its entries past the
+		 * last nonempty row of \f$T\f$ are read
+		 * @param b right-hand side
+		 */
+		template <class Vector1, class Vector2>
+		Vector1 &solve (Vector1 &x, const Vector2 &b) const
+		{
+			const Field &F = field();
+			bool consistent = _checkTail(b, b.size());
+			for (size_t l = 0; l < levels(); ++l) {
+				const long first = (long)_levelStart[l], last = (long)_levelStart[l+1];
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for schedule(static) reduction(&&:consistent) if (last - first >= (long)ParallelThreshold)
+#endif
+				for (long k = first; k < last; ++k) {
+					const size_t i = _order[(size_t)k];
+					if (_empty[i]) {
+						if (!F.isZero(b[i])) consistent = false;
+						F.assign(x[i], F.zero);
+						continue;
+					}
+					Element acc;
+					F.assign(acc, b[i]);
+					for (size_t j = _start[i]; j < _start[i+1]; ++j)
+						F.maxpyin(acc, _val[j], x[_col[j]]);
+					if (_lower)
+						F.assign(x[i], acc);
+					else
+						F.mul(x[i], acc, _inv[i]);
+				}
+			}
+			if (!consistent)
+				throw LinboxError ("SparseTriangularSolver returned INCONSISTENT");
+			return x;
+		}
+
+		/** Solve \f$TX = B\f$ for a block of right-hand sides.
+		 * Each row of the level sets updates the whole row of \f$X\f$.
+		 * @param X dense solution, \f$T.coldim() \times k\f$
+		 * @param B dense right-hand sides, \f$T.rowdim() \times k\f$
+		 */
+		template <class DenseMatrix>
+		DenseMatrix &solveBlock (DenseMatrix &X, const DenseMatrix &B) const
+		{
+			const Field &F = field();
+			const size_t k = B.coldim(), ldx = X.getStride(), ldb = B.getStride();
+			Element * x = X.getWritePointer();
+			const Element * b = B.getPointer();
+			bool consistent = true;
+			for (size_t i = _nrows; i < B.rowdim(); ++i)
+				for (size_t c = 0; c < k; ++c)
+					if (!F.isZero(b[i*ldb+c])) consistent = false;
+
+			for (size_t l = 0; l < levels(); ++l) {
+				const long first = (long)_levelStart[l], last = (long)_levelStart[l+1];
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for schedule(static) reduction(&&:consistent) if ((last - first)*(long)k >= (long)ParallelThreshold)
+#endif
+				for (long kk = first; kk < last; ++kk) {
+					const size_t i = _order[(size_t)kk];
+					Element * xi = x + i*ldx;
+					const Element * bi = b + i*ldb;
+					if (_empty[i]) {
+						for (size_t c = 0; c < k; ++c) {
+							if (!F.isZero(bi[c])) consistent = false;
+							F.assign(xi[c], F.zero);
+						}
+						continue;
+					}
+					for (size_t c = 0; c < k; ++c)
+						F.assign(xi[c], bi[c]);
+					for (size_t j = _start[i]; j < _start[i+1]; ++j) {
+						const Element * xj = x + _col[j]*ldx;
+						for (size_t c = 0; c < k; ++c)
+							F.maxpyin(xi[c], _val[j], xj[c]);
+					}
+					if (!_lower)
+						for (size_t c = 0; c < k; ++c)
+							F.mulin(xi[c], _inv[i]);
+				}
+			}
+			if (!consistent)
+				throw LinboxError ("SparseTriangularSolver returned INCONSISTENT");
+			return X;
+		}
+
+	private:
+		// the rows of b past the rows of T must be zero
+		template <class Vector2>
+		bool _checkTail (const Vector2 &b, size_t m) const
+		{
+			for (size_t i = _nrows; i < m; ++i)
+				if (!field().isZero(b[i])) return false;
+			return true;
+		}
+
+		const Field         *_field;
+		bool                 _lower;
+		size_t               _nrows;      //!< number of rows solved
+		std::vector<size_t>  _start;      //!< row i: entries _start[i].._start[i+1]
+		std::vector<size_t>  _col;
+		std::vector<Element> _val;        //!< off-diagonal entries
+		std::vector<Element> _inv;        //!< inverses of the pivots of U
+		std::vector<bool>    _empty;      //!< empty rows of U: x_i = 0, b_i = 0
+		std::vector<size_t>  _levelStart; //!< level l: rows _order[_levelStart[l]..]
+		std::vector<size_t>  _order;
+	};
+
 }
 #endif //__LINBOX_triangular_solve_H
 
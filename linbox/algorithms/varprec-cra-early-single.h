@@ -67,7 +67,7 @@ namespace LinBox
 				      , const Integer& f=Integer(1)
 				      , const Integer& m=Integer(1)) :
 			EarlySingleCRA<Domain>(EARLY)
-			, FullMultipCRA<Domain>(b)
+			, FullMultipCRA<Domain>(b, 0)
 			, factor_(f)
 			, multip_(m)
 		{
@@ -77,7 +77,7 @@ namespace LinBox
 
 		VarPrecEarlySingleCRA(const VarPrecEarlySingleCRA& other) :
 			EarlySingleCRA<Domain>(other.EARLY_TERM_THRESHOLD)
-			, FullMultipCRA<Domain>(other.LOGARITHMIC_UPPER_BOUND)
+			, FullMultipCRA<Domain>(other.LOGARITHMIC_UPPER_BOUND, 0)
 			, factor_(other.factor_), multip_(other.multip_)
 		{
 			factor_ = 1;
@@ -796,8 +796,11 @@ namespace LinBox
 					chrono.clear();
 					chrono.start();
 #endif
-					// perform multiplication componentwise
-					for (size_t i=0;i< rns_size; ++i)
+					// perform multiplication componentwise, the moduli are independent
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+					for (long i=0;i< (long)rns_size; ++i)
 						cblas_dgemv(CblasRowMajor, CblasNoTrans, (int) _m, (int) _n,
 							    1, chunks+i*_m*_n, (int) _n, vchunks+i*_n, 1, 0, ctd+i*_m, 1);
 #ifdef TIMING_APPLY
@@ -834,13 +837,13 @@ namespace LinBox
 #endif
 
 
-					// reconstruct the result using CRT
-					std::vector<double> tmp(rns_size);
+					// reconstruct the result using CRT, directly from the rns planes
+					for (size_t i=0;i<rns_size;++i)
+						for (size_t j=0;j<_m;++j)
+							_rns->getBase(i).init(ctd[j+i*_m], ctd[j+i*_m]);
 					integer res;
 					for (size_t j=0;j<_m;++j){
-						for (size_t i=0;i<rns_size;++i)
-							_rns->getBase(i).init(tmp[i], ctd[j+i*_m]);
-						_rns->convert(res, tmp);
+						_rns->convert(res, ctd+j, _m);
 						_domain.init(y[j], res);
 						//if (y[j] > hmod) y[j]-=mod;
 					}
@@ -389,6 +389,10 @@ namespace LinBox
 		const Blackbox* getRightPtr() const
 		{return  _BlackboxL.back();}
 
+		//! number of blackboxes in the product
+		size_t length() const
+		{return  _BlackboxL.size();}
+
 
 	protected:
 
@@ -0,0 +1,506 @@
+/* linbox/blackbox/fft-toeplitz.h
+ * Copyright (C) 2026 the LinBox group
+ *
+ * ========LICENCE========
+ * This file is part of the library LinBox.
+ *
+ * LinBox is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ */
+
+/*! @file blackbox/fft-toeplitz.h
+ * @ingroup blackbox
+ * @brief Toeplitz, Hankel and block Toeplitz blackboxes over word size
+ * prime fields, applied with LinBox's own FFT.
+ */
+
+#ifndef __LINBOX_fft_toeplitz_H
+#define __LINBOX_fft_toeplitz_H
+
+#include <vector>
+#include <algorithm>
+#include <iostream>
+#include <type_traits>
+
+#include "linbox/linbox-config.h"
+#include "linbox/util/debug.h"
+#include "linbox/ring/modular.h"
+#include "linbox/blackbox/blackbox-interface.h"
+#include "linbox/solutions/solution-tags.h"
+#include "linbox/matrix/dense-matrix.h"
+#include "linbox/algorithms/toeplitz-det.h"
+#include "linbox/algorithms/polynomial-matrix/polynomial-fft-transform.h"
+
+namespace LinBox
+{
+
+	/*! Whether the elements of \p Field are stored in \f$[0,p)\f$.
+	 * \c FFT_transform copies them to unsigned words, so that the FFT
+	 * products are wrong with a balanced representation.
+	 */
+	template <class Field>
+	struct FFTToeplitzNonNegative : std::false_type {};
+
+	template <class... T>
+	struct FFTToeplitzNonNegative<Givaro::Modular<T...> > : std::true_type {};
+
+	/** \brief Products by a block Toeplitz generator, by FFT.
+	 *
+	 * The matrix has \f$m \times n\f$ blocks of size \f$r \times c\f$,
+	 * block \f$(i,j)\f$ being \f$G_{n-1+i-j}\f$: \f$G_0\f$ is the top
+	 * right block and \f$G_{m+n-2}\f$ the bottom left one. A product by
+	 * the matrix is then the middle part of a product of polynomials,
+	 * which is computed by a cyclic convolution of \f$2^k \geq m+n-1\f$
+	 * points with \c FFT_transform. The transforms of the generator, and
+	 * of the reversed generator for the transpose, are computed once at
+	 * construction.
+	 *
+	 * The FFT requires a prime \f$p < 2^{29}\f$ with \f$2^k \mid p-1\f$
+	 * and a \c Givaro::Modular field (not \c ModularBalanced, see
+	 * FFTToeplitzNonNegative); otherwise, or for fewer than
+	 * \c Threshold points, the products are computed directly in
+	 * \f$O(mnrc)\f$.
+	 *
+	 * The products do not modify the object, so that they may be called
+	 * concurrently.
+	 */
+	template <class _Field>
+	class FFTToeplitzBase : public BlackboxInterface {
+	public:
+		typedef _Field                  Field;
+		typedef typename Field::Element Element;
+
+		//! Smallest number of points for which the FFT is used
+		static const size_t Threshold = 64;
+
+		const Field & field () const { return *_field; }
+
+		//! Whether the products are computed by FFT
+		bool usesFFT () const { return _fft; }
+
+	protected:
+		/* The generator is given by its entries:
+		 * gen[(a*c+b)*(m+n-1) + k] is the entry (a,b) of G_k.
+		 */
+		FFTToeplitzBase (const Field & F, size_t m, size_t n, size_t r, size_t c,
+				 const std::vector<Element> & gen) :
+			_field(&F), _m(m), _n(n), _r(r), _c(c), _len(m+n-1), _gen(gen),
+			_lpts(0), _pts(1), _fft(false)
+		{
+			linbox_check(m && n && _gen.size() == r*c*_len);
+			while (_pts < _len) {
+				_pts <<= 1;
+				++_lpts;
+			}
+			const uint64_t p = (uint64_t) F.characteristic();
+			_fft = FFTToeplitzNonNegative<Field>::value
+				&& _len >= Threshold && (p >> 29) == 0 && (p-1) % _pts == 0;
+			if (!_fft)
+				return;
+
+			FFT_transform<Field> D(F, _lpts);
+			_w = D.getRoot();
+			_invw = D.getInvRoot();
+			F.init(_invpts, _pts);
+			F.invin(_invpts);
+
+			_G.assign(r*c*_pts, F.zero);
+			_Gt.assign(r*c*_pts, F.zero);
+			for (size_t e = 0; e < r*c; ++e) {
+				const Element * g = &_gen[e*_len];
+				Element * G = &_G[e*_pts], * Gt = &_Gt[e*_pts];
+				std::copy(g, g+_len, G);
+				std::reverse_copy(g, g+_len, Gt);
+				D.FFT_DIF(G);
+				D.FFT_DIF(Gt);
+			}
+		}
+
+		/* Products of A (or A^T) by k vectors: in(j,l) is the l-th entry
+		 * of the j-th vector, out(j,l) the l-th entry of its product.
+		 */
+		template <class In, class Out>
+		void _product (size_t k, In in, Out out, bool trans) const
+		{
+			const Field & F = field();
+			// the product is a Toeplitz matrix of M x N blocks of size R x C
+			const size_t M = trans ? _n : _m, N = trans ? _m : _n;
+			const size_t R = trans ? _c : _r, C = trans ? _r : _c;
+			// generator entry (a,b) of the product
+			auto entry = [&] (size_t a, size_t b) -> size_t {
+				return trans ? b*_c+a : a*_c+b;
+			};
+
+			if (!_fft) {
+				Element s;
+				for (size_t j = 0; j < k; ++j)
+					for (size_t i = 0; i < M; ++i)
+						for (size_t a = 0; a < R; ++a) {
+							F.assign(s, F.zero);
+							for (size_t l = 0; l < N; ++l) {
+								// G_{N-1+i-l} of the product
+								const size_t d = trans ? M-1-i+l : N-1+i-l;
+								for (size_t b = 0; b < C; ++b)
+									F.axpyin(s, _gen[entry(a,b)*_len+d], in(j, l*C+b));
+							}
+							F.assign(out(j, i*R+a), s);
+						}
+				return;
+			}
+
+			// built for this call: FFT_transform has its own buffer
+			FFT_transform<Field> D(F, _lpts, _w), I(F, _lpts, _invw);
+			const std::vector<Element> & G = trans ? _Gt : _G;
+			std::vector<Element> X(C*_pts), Y(_pts);
+			for (size_t j = 0; j < k; ++j) {
+				for (size_t b = 0; b < C; ++b) {
+					Element * Xb = &X[b*_pts];
+					for (size_t l = 0; l < N; ++l)
+						F.assign(Xb[l], in(j, l*C+b));
+					std::fill(Xb+N, Xb+_pts, F.zero);
+					D.FFT_DIF(Xb);
+				}
+				for (size_t a = 0; a < R; ++a) {
+					std::fill(Y.begin(), Y.end(), F.zero);
+					for (size_t b = 0; b < C; ++b) {
+						const Element * Gab = &G[entry(a,b)*_pts], * Xb = &X[b*_pts];
+						for (size_t t = 0; t < _pts; ++t)
+							F.axpyin(Y[t], Gab[t], Xb[t]);
+					}
+					I.FFT_DIT(&Y[0]);
+					// the coefficients N-1 .. M+N-2 are not wrapped around
+					for (size_t i = 0; i < M; ++i)
+						F.mul(out(j, i*R+a), Y[N-1+i], _invpts);
+				}
+			}
+		}
+
+		const Field          *_field;
+		size_t                _m, _n;   //!< number of block rows and columns
+		size_t                _r, _c;   //!< block dimensions
+		size_t                _len;     //!< m+n-1
+		std::vector<Element>  _gen;
+		size_t                _lpts, _pts;
+		bool                  _fft;
+		Element               _w, _invw, _invpts;
+		std::vector<Element>  _G, _Gt;  //!< transforms of the generator and of its reverse
+	};
+
+	/** \brief Toeplitz matrix over a word size prime field, applied by FFT.
+	 *
+	 * \ingroup blackbox
+	 * The \f$m \times n\f$ matrix with entries \f$v_{n-1+i-j}\f$, stored
+	 * as its \f$m+n-1\f$ values as in Toeplitz, without NTL.
+	 * \c applyRight and \c applyLeft apply it to several vectors with the
+	 * same precomputed transforms. See FFTToeplitzBase for the conditions
+	 * on the field.
+	 */
+	template <class _Field>
+	class FFTToeplitz : public FFTToeplitzBase<_Field> {
+		typedef FFTToeplitzBase<_Field> Father_t;
+		using Father_t::_m;
+		using Father_t::_n;
+		using Father_t::_gen;
+		using Father_t::_product;
+	public:
+		typedef typename Father_t::Field   Field;
+		typedef typename Father_t::Element Element;
+		using Father_t::field;
+
+		//! Square matrix of order \f$(|v|+1)/2\f$
+		FFTToeplitz (const Field & F, const std::vector<Element> & v) :
+			Father_t(F, (v.size()+1)/2, (v.size()+1)/2, 1, 1, v)
+		{}
+
+		//! \f$m \times n\f$ matrix, \f$|v| = m+n-1\f$
+		FFTToeplitz (const Field & F, const std::vector<Element> & v, size_t m, size_t n) :
+			Father_t(F, m, n, 1, 1, v)
+		{}
+
+		size_t rowdim () const { return _m; }
+		size_t coldim () const { return _n; }
+
+		template <class OutVector, class InVector>
+		OutVector & apply (OutVector & y, const InVector & x) const
+		{
+			linbox_check(y.size() == rowdim() && x.size() == coldim());
+			_product(1, [&x] (size_t, size_t l) -> const Element & { return x[l]; },
+				 [&y] (size_t, size_t l) -> Element & { return y[l]; }, false);
+			return y;
+		}
+
+		template <class OutVector, class InVector>
+		OutVector & applyTranspose (OutVector & y, const InVector & x) const
+		{
+			linbox_check(y.size() == coldim() && x.size() == rowdim());
+			_product(1, [&x] (size_t, size_t l) -> const Element & { return x[l]; },
+				 [&y] (size_t, size_t l) -> Element & { return y[l]; }, true);
+			return y;
+		}
+
+		//! \f$Y = AX\f$, one product per column of \p X
+		template <class Matrix>
+		Matrix & applyRight (Matrix & Y, const Matrix & X) const
+		{
+			linbox_check(X.rowdim() == coldim() && Y.rowdim() == rowdim() && Y.coldim() == X.coldim());
+			_product(X.coldim(), [&X] (size_t j, size_t l) -> const Element & { return X.getEntry(l, j); },
+				 [&Y] (size_t j, size_t l) -> Element & { return Y.refEntry(l, j); }, false);
+			return Y;
+		}
+
+		//! \f$Y = XA\f$, one product per row of \p X
+		template <class Matrix>
+		Matrix & applyLeft (Matrix & Y, const Matrix & X) const
+		{
+			linbox_check(X.coldim() == rowdim() && Y.coldim() == coldim() && Y.rowdim() == X.rowdim());
+			_product(X.rowdim(), [&X] (size_t j, size_t l) -> const Element & { return X.getEntry(j, l); },
+				 [&Y] (size_t j, size_t l) -> Element & { return Y.refEntry(j, l); }, true);
+			return Y;
+		}
+
+		Element & getEntry (Element & x, size_t i, size_t j) const
+		{
+			return field().assign(x, _gen[_n-1+i-j]);
+		}
+
+		//! Determinant of a square matrix, by toeplitz_determinant
+		Element & det (Element & d) const
+		{
+			linbox_check(rowdim() == coldim());
+			return toeplitz_determinant(field(), d, _gen, _n);
+		}
+
+		Element & trace (Element & t) const
+		{
+			field().init(t, std::min(_m, _n));
+			return field().mulin(t, _gen[_n-1]);
+		}
+
+		std::ostream & write (std::ostream & os) const
+		{
+			os << rowdim() << " " << coldim() << std::endl << "[";
+			for (size_t k = _gen.size(); k--; )
+				field().write(os, _gen[k]) << (k ? " " : "");
+			return os << "]" << std::endl;
+		}
+	};
+
+	/** \brief Hankel matrix over a word size prime field, applied by FFT.
+	 *
+	 * \ingroup blackbox
+	 * The \f$m \times n\f$ matrix with entries \f$h_{i+j}\f$. It is the
+	 * Toeplitz matrix with the same values and reversed columns, and
+	 * its transpose is the \f$n \times m\f$ Hankel matrix with the same
+	 * values.
+	 */
+	template <class _Field>
+	class FFTHankel : public BlackboxInterface {
+	public:
+		typedef _Field                  Field;
+		typedef typename Field::Element Element;
+
+		//! Square matrix of order \f$(|h|+1)/2\f$
+		FFTHankel (const Field & F, const std::vector<Element> & h) :
+			_T(F, h)
+		{}
+
+		//! \f$m \times n\f$ matrix, \f$|h| = m+n-1\f$
+		FFTHankel (const Field & F, const std::vector<Element> & h, size_t m, size_t n) :
+			_T(F, h, m, n)
+		{}
+
+		const Field & field () const { return _T.field(); }
+		size_t rowdim () const { return _T.rowdim(); }
+		size_t coldim () const { return _T.coldim(); }
+		bool usesFFT () const { return _T.usesFFT(); }
+
+		template <class OutVector, class InVector>
+		OutVector & apply (OutVector & y, const InVector & x) const
+		{
+			std::vector<Element> z(x.rbegin(), x.rend());
+			return _T.apply(y, z);
+		}
+
+		template <class OutVector, class InVector>
+		OutVector & applyTranspose (OutVector & y, const InVector & x) const
+		{
+			_T.applyTranspose(y, x);
+			std::reverse(y.begin(), y.end());
+			return y;
+		}
+
+		//! \f$Y = AX\f$, one product per column of \p X
+		template <class Matrix>
+		Matrix & applyRight (Matrix & Y, const Matrix & X) const
+		{
+			Matrix Z(X.field(), X.rowdim(), X.coldim());
+			const size_t n = X.rowdim();
+			for (size_t i = 0; i < n; ++i)
+				for (size_t j = 0; j < X.coldim(); ++j)
+					Z.setEntry(n-1-i, j, X.getEntry(i, j));
+			return _T.applyRight(Y, Z);
+		}
+
+		//! \f$Y = XA\f$, one product per row of \p X
+		template <class Matrix>
+		Matrix & applyLeft (Matrix & Y, const Matrix & X) const
+		{
+			Matrix Z(Y.field(), Y.rowdim(), Y.coldim());
+			_T.applyLeft(Z, X);
+			const size_t n = Y.coldim();
+			for (size_t i = 0; i < Y.rowdim(); ++i)
+				for (size_t j = 0; j < n; ++j)
+					Y.setEntry(i, j, Z.getEntry(i, n-1-j));
+			return Y;
+		}
+
+		Element & getEntry (Element & x, size_t i, size_t j) const
+		{
+			return _T.getEntry(x, i, coldim()-1-j);
+		}
+
+		//! \f$\det(H) = (-1)^{\lfloor n/2 \rfloor} \det(T)\f$
+		Element & det (Element & d) const
+		{
+			_T.det(d);
+			if ((coldim() / 2) & 1)
+				field().negin(d);
+			return d;
+		}
+
+		std::ostream & write (std::ostream & os) const
+		{
+			return _T.write(os);
+		}
+
+	private:
+		FFTToeplitz<Field> _T;
+	};
+
+	/** \brief Block Toeplitz matrix over a word size prime field, applied by FFT.
+	 *
+	 * \ingroup blackbox
+	 * The matrix of \f$m \times n\f$ blocks of size \f$r \times c\f$,
+	 * block \f$(i,j)\f$ being \f$G_{n-1+i-j}\f$. Each of the \f$rc\f$
+	 * scalar sequences of the generator is transformed once; a product
+	 * then costs \f$c\f$ direct and \f$r\f$ inverse transforms, and the
+	 * \f$r \times c\f$ products at each point.
+	 */
+	template <class _Field>
+	class FFTBlockToeplitz : public FFTToeplitzBase<_Field> {
+		typedef FFTToeplitzBase<_Field> Father_t;
+		using Father_t::_m;
+		using Father_t::_n;
+		using Father_t::_r;
+		using Father_t::_c;
+		using Father_t::_len;
+		using Father_t::_gen;
+		using Father_t::_product;
+	public:
+		typedef typename Father_t::Field   Field;
+		typedef typename Father_t::Element Element;
+		using Father_t::field;
+
+		/** \f$m \times n\f$ blocks.
+		 * @param G the \f$m+n-1\f$ blocks \f$G_0, \ldots, G_{m+n-2}\f$, all of the same dimensions
+		 */
+		FFTBlockToeplitz (const Field & F, const std::vector<BlasMatrix<Field> > & G, size_t m, size_t n) :
+			Father_t(F, m, n, G[0].rowdim(), G[0].coldim(), _entries(G))
+		{
+			linbox_check(G.size() == m+n-1);
+		}
+
+		size_t rowdim () const { return _m*_r; }
+		size_t coldim () const { return _n*_c; }
+		size_t rowblockdim () const { return _r; }
+		size_t colblockdim () const { return _c; }
+
+		template <class OutVector, class InVector>
+		OutVector & apply (OutVector & y, const InVector & x) const
+		{
+			linbox_check(y.size() == rowdim() && x.size() == coldim());
+			_product(1, [&x] (size_t, size_t l) -> const Element & { return x[l]; },
+				 [&y] (size_t, size_t l) -> Element & { return y[l]; }, false);
+			return y;
+		}
+
+		template <class OutVector, class InVector>
+		OutVector & applyTranspose (OutVector & y, const InVector & x) const
+		{
+			linbox_check(y.size() == coldim() && x.size() == rowdim());
+			_product(1, [&x] (size_t, size_t l) -> const Element & { return x[l]; },
+				 [&y] (size_t, size_t l) -> Element & { return y[l]; }, true);
+			return y;
+		}
+
+		//! \f$Y = AX\f$, one product per column of \p X
+		template <class Matrix>
+		Matrix & applyRight (Matrix & Y, const Matrix & X) const
+		{
+			linbox_check(X.rowdim() == coldim() && Y.rowdim() == rowdim() && Y.coldim() == X.coldim());
+			_product(X.coldim(), [&X] (size_t j, size_t l) -> const Element & { return X.getEntry(l, j); },
+				 [&Y] (size_t j, size_t l) -> Element & { return Y.refEntry(l, j); }, false);
+			return Y;
+		}
+
+		//! \f$Y = XA\f$, one product per row of \p X
+		template <class Matrix>
+		Matrix & applyLeft (Matrix & Y, const Matrix & X) const
+		{
+			linbox_check(X.coldim() == rowdim() && Y.coldim() == coldim() && Y.rowdim() == X.rowdim());
+			_product(X.rowdim(), [&X] (size_t j, size_t l) -> const Element & { return X.getEntry(j, l); },
+				 [&Y] (size_t j, size_t l) -> Element & { return Y.refEntry(j, l); }, true);
+			return Y;
+		}
+
+		Element & getEntry (Element & x, size_t i, size_t j) const
+		{
+			const size_t k = _n-1+i/_r-j/_c, a = i%_r, b = j%_c;
+			return field().assign(x, _gen[(a*_c+b)*_len+k]);
+		}
+
+	private:
+		static std::vector<Element> _entries (const std::vector<BlasMatrix<Field> > & G)
+		{
+			const size_t len = G.size(), r = G[0].rowdim(), c = G[0].coldim();
+			std::vector<Element> gen(r*c*len);
+			for (size_t k = 0; k < len; ++k)
+				for (size_t a = 0; a < r; ++a)
+					for (size_t b = 0; b < c; ++b)
+						gen[(a*c+b)*len+k] = G[k].getEntry(a, b);
+			return gen;
+		}
+	};
+
+	template <class Field>
+	struct DetCategory<FFTToeplitz<Field> > { typedef typename SolutionTags::Local Tag; };
+
+	template <class Field>
+	struct TraceCategory<FFTToeplitz<Field> > { typedef typename SolutionTags::Local Tag; };
+
+	template <class Field>
+	struct DetCategory<FFTHankel<Field> > { typedef typename SolutionTags::Local Tag; };
+
+} // namespace LinBox
+
+#endif //__LINBOX_fft_toeplitz_H
+
+// Local Variables:
+// mode: C++
+// tab-width: 4
+// indent-tabs-mode: nil
+// c-basic-offset: 4
+// End:
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
@@ -0,0 +1,936 @@
+/* linbox/blackbox/fused-sparse.h
+ * Copyright (C) 2026 the LinBox group
+ *
+ * ========LICENCE========
+ * This file is part of the library LinBox.
+ *
+ * LinBox is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ */
+
+/*! @file blackbox/fused-sparse.h
+ * @ingroup blackbox
+ * @brief Diagonal scalings, permutations and transposes fused into a sparse matrix.
+ *
+ * Preconditioners such as \f$D_1 P A D_2\f$ are usually built with nested
+ * \c Compose, which costs one pass over a temporary vector per factor and
+ * per apply. Here, the product is described by an expression whose type
+ * records the factors at compile time:
+ * \code
+ * FusedSparse<Field> B (fusedScaleCols (fusedScaleRows (D1, fused (A)), D2));
+ * \endcode
+ * and the scalings and index remappings are folded into the entries of
+ * \p B once, at construction. Each apply of \p B is then a single sparse
+ * matrix-vector product. \c FusedNormal applies \f$E^T D E\f$ in a single
+ * traversal of the entries of \p E.
+ */
+
+#ifndef __LINBOX_fused_sparse_H
+#define __LINBOX_fused_sparse_H
+
+#include <memory>
+#include <vector>
+
+#include "linbox/util/debug.h"
+#include "linbox/util/field-axpy.h"
+#include "linbox/blackbox/blackbox-interface.h"
+#include "linbox/blackbox/compose.h"
+#include "linbox/blackbox/diagonal.h"
+#include "linbox/blackbox/permutation.h"
+#include "linbox/blackbox/transpose.h"
+#include "linbox/matrix/dense-matrix.h"
+#include "linbox/matrix/sparse-matrix.h"
+#include "linbox/solutions/solution-tags.h"
+#include "linbox/vector/blas-vector.h"
+
+#ifdef __LINBOX_USE_OPENMP
+#include <omp.h>
+#endif
+
+namespace LinBox
+{
+
+	/*! @name Fused expressions.
+	 * Each node enumerates the nonzero entries \f$(i,j,a)\f$ of the
+	 * product it stands for with \c forEach, by rewriting those of its
+	 * operand on the fly.
+	 */
+	//@{
+
+	/** Enumeration of the nonzero entries of a sparse matrix.
+	 * The generic version uses \c IndexedBegin()/IndexedEnd(), as provided
+	 * by the SparseSeq, SparsePar and SparseMap formats.
+	 */
+	template <class Matrix>
+	struct FusedEntries {
+		template <class Op>
+		static void forEach (const Matrix& A, Op& op)
+		{
+			for (auto it = A.IndexedBegin(); it != A.IndexedEnd(); ++it)
+				op (it.rowIndex(), it.colIndex(), it.value());
+		}
+	};
+
+	template <class Field>
+	struct FusedEntries<SparseMatrix<Field, SparseMatrixFormat::CSR> > {
+		template <class Op>
+		static void forEach (const SparseMatrix<Field, SparseMatrixFormat::CSR>& A, Op& op)
+		{
+			for (size_t i = 0; i < A.rowdim(); ++i)
+				for (size_t k = A.getStart(i); k < A.getEnd(i); ++k)
+					op (i, A.getColid(k), A.getData(k));
+		}
+	};
+
+	template <class Field>
+	struct FusedEntries<SparseMatrix<Field, SparseMatrixFormat::ELL> > {
+		template <class Op>
+		static void forEach (const SparseMatrix<Field, SparseMatrixFormat::ELL>& A, Op& op)
+		{
+			for (size_t i = 0; i < A.rowdim(); ++i)
+				for (size_t k = 0; k < A.ld(); ++k)
+					if (!A.field().isZero (A.getData(i,k)))
+						op (i, A.getColid(i,k), A.getData(i,k));
+		}
+	};
+
+	template <class Field>
+	struct FusedEntries<SparseMatrix<Field, SparseMatrixFormat::TPL> > {
+		template <class Op>
+		static void forEach (const SparseMatrix<Field, SparseMatrixFormat::TPL>& A, Op& op)
+		{
+			for (size_t k = 0; k < A.refDataConst().size(); ++k)
+				op (A.refDataConst()[k].row, A.refDataConst()[k].col, A.refDataConst()[k].elt);
+		}
+	};
+
+#ifdef _OPENMP
+	//! \p A must be finalized
+	template <class Field>
+	struct FusedEntries<SparseMatrix<Field, SparseMatrixFormat::TPL_omp> > {
+		template <class Op>
+		static void forEach (const SparseMatrix<Field, SparseMatrixFormat::TPL_omp>& A, Op& op)
+		{
+			for (size_t k = 0; k < A.refDataConst().size(); ++k)
+				op (A.refDataConst()[k].getRow(), A.refDataConst()[k].getCol(), A.refDataConst()[k].getElt());
+		}
+	};
+#endif
+
+	/// The entries of a sparse matrix, see \c FusedEntries.
+	template <class Matrix>
+	struct FusedLeaf {
+		typedef typename Matrix::Field Field;
+		typedef typename Field::Element Element;
+
+		const Matrix& _A;
+
+		FusedLeaf (const Matrix& A) : _A(A) {}
+
+		const Field& field() const { return _A.field(); }
+		size_t rowdim() const { return _A.rowdim(); }
+		size_t coldim() const { return _A.coldim(); }
+
+		template <class Op>
+		void forEach (Op& op) const
+		{
+			FusedEntries<Matrix>::forEach (_A, op);
+		}
+	};
+
+	/// D E
+	template <class Expr>
+	struct FusedRowScale {
+		typedef typename Expr::Field Field;
+		typedef typename Field::Element Element;
+
+		const Diagonal<Field>& _D;
+		const Expr _E;
+
+		FusedRowScale (const Diagonal<Field>& D, const Expr& E) : _D(D), _E(E)
+		{ linbox_check (D.coldim() == E.rowdim()); }
+
+		const Field& field() const { return _E.field(); }
+		size_t rowdim() const { return _E.rowdim(); }
+		size_t coldim() const { return _E.coldim(); }
+
+		template <class Op>
+		void forEach (Op& op) const
+		{
+			const Field& F = field();
+			const typename Diagonal<Field>::Vector_t& d = _D.getData();
+			Element b;
+			auto scaled = [&](size_t i, size_t j, const Element& a) {
+				F.mul (b, d[i], a);
+				op (i, j, b);
+			};
+			_E.forEach (scaled);
+		}
+	};
+
+	/// E D
+	template <class Expr>
+	struct FusedColScale {
+		typedef typename Expr::Field Field;
+		typedef typename Field::Element Element;
+
+		const Expr _E;
+		const Diagonal<Field>& _D;
+
+		FusedColScale (const Expr& E, const Diagonal<Field>& D) : _E(E), _D(D)
+		{ linbox_check (E.coldim() == D.rowdim()); }
+
+		const Field& field() const { return _E.field(); }
+		size_t rowdim() const { return _E.rowdim(); }
+		size_t coldim() const { return _E.coldim(); }
+
+		template <class Op>
+		void forEach (Op& op) const
+		{
+			const Field& F = field();
+			const typename Diagonal<Field>::Vector_t& d = _D.getData();
+			Element b;
+			auto scaled = [&](size_t i, size_t j, const Element& a) {
+				F.mul (b, a, d[j]);
+				op (i, j, b);
+			};
+			_E.forEach (scaled);
+		}
+	};
+
+	/// P E: entry (P[i],j) of E goes to row i.
+	template <class Expr>
+	struct FusedRowPermute {
+		typedef typename Expr::Field Field;
+		typedef typename Field::Element Element;
+
+		const Expr _E;
+		std::vector<size_t> _inv;
+
+		FusedRowPermute (const Permutation<Field>& P, const Expr& E) :
+			_E(E), _inv(P.rowdim())
+		{
+			linbox_check (P.coldim() == E.rowdim());
+			for (size_t i = 0; i < _inv.size(); ++i)
+				_inv[P[i]] = i;
+		}
+
+		const Field& field() const { return _E.field(); }
+		size_t rowdim() const { return _E.rowdim(); }
+		size_t coldim() const { return _E.coldim(); }
+
+		template <class Op>
+		void forEach (Op& op) const
+		{
+			auto permuted = [&](size_t i, size_t j, const Element& a) { op (_inv[i], j, a); };
+			_E.forEach (permuted);
+		}
+	};
+
+	/// E P: entry (i,j) of E goes to column P[j].
+	template <class Expr>
+	struct FusedColPermute {
+		typedef typename Expr::Field Field;
+		typedef typename Field::Element Element;
+
+		const Expr _E;
+		const Permutation<Field>& _P;
+
+		FusedColPermute (const Expr& E, const Permutation<Field>& P) : _E(E), _P(P)
+		{ linbox_check (E.coldim() == P.rowdim()); }
+
+		const Field& field() const { return _E.field(); }
+		size_t rowdim() const { return _E.rowdim(); }
+		size_t coldim() const { return _E.coldim(); }
+
+		template <class Op>
+		void forEach (Op& op) const
+		{
+			auto permuted = [&](size_t i, size_t j, const Element& a) { op (i, _P[j], a); };
+			_E.forEach (permuted);
+		}
+	};
+
+	/// E^T
+	template <class Expr>
+	struct FusedTranspose {
+		typedef typename Expr::Field Field;
+		typedef typename Field::Element Element;
+
+		const Expr _E;
+
+		FusedTranspose (const Expr& E) : _E(E) {}
+
+		const Field& field() const { return _E.field(); }
+		size_t rowdim() const { return _E.coldim(); }
+		size_t coldim() const { return _E.rowdim(); }
+
+		template <class Op>
+		void forEach (Op& op) const
+		{
+			auto transposed = [&](size_t i, size_t j, const Element& a) { op (j, i, a); };
+			_E.forEach (transposed);
+		}
+	};
+
+	template <class Matrix>
+	FusedLeaf<Matrix> fused (const Matrix& A)
+	{ return FusedLeaf<Matrix>(A); }
+
+	template <class Expr>
+	FusedRowScale<Expr> fusedScaleRows (const Diagonal<typename Expr::Field>& D, const Expr& E)
+	{ return FusedRowScale<Expr>(D, E); }
+
+	template <class Expr>
+	FusedColScale<Expr> fusedScaleCols (const Expr& E, const Diagonal<typename Expr::Field>& D)
+	{ return FusedColScale<Expr>(E, D); }
+
+	template <class Expr>
+	FusedRowPermute<Expr> fusedPermuteRows (const Permutation<typename Expr::Field>& P, const Expr& E)
+	{ return FusedRowPermute<Expr>(P, E); }
+
+	template <class Expr>
+	FusedColPermute<Expr> fusedPermuteCols (const Expr& E, const Permutation<typename Expr::Field>& P)
+	{ return FusedColPermute<Expr>(E, P); }
+
+	template <class Expr>
+	FusedTranspose<Expr> fusedTranspose (const Expr& E)
+	{ return FusedTranspose<Expr>(E); }
+	//@}
+
+	/** \brief Blackbox of a fused expression.
+	 * \ingroup blackbox
+	 *
+	 * The entries of the expression are stored row-wise (CSR) with the
+	 * scalings already applied; \c apply and \c applyTranspose make one
+	 * pass over them and none over intermediate vectors.
+	 */
+	template <class _Field>
+	class FusedSparse : public BlackboxInterface {
+	public:
+		typedef _Field Field;
+		typedef typename Field::Element Element;
+		typedef FusedSparse<Field> Self_t;
+
+		template <class Expr>
+		FusedSparse (const Expr& E) :
+			_field(&E.field()), _m(E.rowdim()), _n(E.coldim()), _start(_m+1, 0)
+		{
+			auto count = [&](size_t i, size_t, const Element&) { ++_start[i+1]; };
+			E.forEach (count);
+			for (size_t i = 0; i < _m; ++i)
+				_start[i+1] += _start[i];
+
+			_col.resize (_start[_m]);
+			_val.resize (_start[_m]);
+			std::vector<size_t> pos (_start.begin(), _start.end()-1);
+			auto fill = [&](size_t i, size_t j, const Element& a) {
+				size_t k = pos[i]++;
+				_col[k] = j;
+				_val[k] = a;
+			};
+			E.forEach (fill);
+		}
+
+		/// y = B x
+		template <class OutVector, class InVector>
+		OutVector &apply (OutVector &y, const InVector &x) const
+		{
+			linbox_check (x.size() == _n);
+			linbox_check (y.size() == _m);
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for schedule(static) if (_val.size() > 100000)
+#endif
+			for (long i = 0; i < (long)_m; ++i) {
+				FieldAXPY<Field> acc (field());
+				for (size_t k = _start[(size_t)i]; k < _start[(size_t)i+1]; ++k)
+					acc.mulacc (_val[k], x[_col[k]]);
+				acc.get (y[(size_t)i]);
+			}
+			return y;
+		}
+
+		/// y = B^T x
+		template <class OutVector, class InVector>
+		OutVector &applyTranspose (OutVector &y, const InVector &x) const
+		{
+			linbox_check (x.size() == _m);
+			linbox_check (y.size() == _n);
+			for (size_t j = 0; j < _n; ++j)
+				field().assign (y[j], field().zero);
+			for (size_t i = 0; i < _m; ++i)
+				for (size_t k = _start[i]; k < _start[i+1]; ++k)
+					field().axpyin (y[_col[k]], _val[k], x[i]);
+			return y;
+		}
+
+		size_t rowdim () const { return _m; }
+		size_t coldim () const { return _n; }
+		const Field& field () const { return *_field; }
+
+		/// number of stored entries
+		size_t size () const { return _val.size(); }
+
+		/// entries of row i are [getStart(i), getEnd(i))
+		size_t getStart (size_t i) const { return _start[i]; }
+		size_t getEnd (size_t i) const { return _start[i+1]; }
+		size_t getColid (size_t k) const { return _col[k]; }
+		const Element& getData (size_t k) const { return _val[k]; }
+
+		Element &getEntry (Element &x, size_t i, size_t j) const
+		{
+			field().assign (x, field().zero);
+			for (size_t k = _start[i]; k < _start[i+1]; ++k)
+				if (_col[k] == j) field().addin (x, _val[k]);
+			return x;
+		}
+
+		Element &trace (Element &t) const
+		{
+			Element x;
+			field().assign (t, field().zero);
+			for (size_t i = 0; i < std::min (_m, _n); ++i)
+				field().addin (t, getEntry (x, i, i));
+			return t;
+		}
+
+	protected:
+		const Field*         _field;
+		size_t               _m, _n;
+		std::vector<size_t>  _start; //!< row i is [_start[i], _start[i+1])
+		std::vector<size_t>  _col;
+		std::vector<Element> _val;
+	};
+
+	template <class Field>
+	struct GetEntryCategory<FusedSparse<Field> > { typedef SolutionTags::Local Tag; };
+
+	template <class Field>
+	struct TraceCategory<FusedSparse<Field> > { typedef SolutionTags::Local Tag; };
+
+	/** Normal operator \f$E^T D E\f$ of a fused expression \p E.
+	 * \ingroup blackbox
+	 *
+	 * \f$y = E^T D E x\f$ is computed in one traversal of the rows of
+	 * \p E: the dot product of row \p i with \p x, scaled by \f$d_i\f$,
+	 * is immediately scattered along the same row. With several OpenMP
+	 * threads, each thread scatters its rows into its own accumulator and
+	 * the accumulators are summed afterwards.
+	 * \f$A D A^T\f$ is the normal operator of \c fusedTranspose(fused(A)).
+	 *
+	 * \f$S E^T D E S\f$, for a diagonal \f$S\f$, shares the entries of
+	 * \p E: \f$S\f$ scales the vectors on input and output.
+	 */
+	template <class _Field>
+	class FusedNormal : public BlackboxInterface {
+	public:
+		typedef _Field Field;
+		typedef typename Field::Element Element;
+		typedef FusedNormal<Field> Self_t;
+
+		//! below this number of entries, apply is sequential
+		static const size_t ParallelThreshold = 100000;
+
+		/// E^T E
+		template <class Expr>
+		FusedNormal (const Expr& E) :
+			_E(new FusedSparse<Field> (E)), _d(E.field()), _s(E.field())
+		{}
+
+		/// E^T D E
+		template <class Expr>
+		FusedNormal (const Expr& E, const Diagonal<Field>& D) :
+			_E(new FusedSparse<Field> (E)), _d(D.getData()), _s(E.field())
+		{
+			linbox_check (D.rowdim() == E.rowdim());
+		}
+
+		/// S E^T D E S, with the entries of E shared
+		FusedNormal (const std::shared_ptr<const FusedSparse<Field> >& E,
+			     const BlasVector<Field>& d, const BlasVector<Field>& s) :
+			_E(E), _d(d), _s(s)
+		{
+			linbox_check (d.size() == E->rowdim());
+			linbox_check (s.size() == E->coldim());
+		}
+
+		template <class OutVector, class InVector>
+		OutVector &apply (OutVector &y, const InVector &x) const
+		{
+			linbox_check (x.size() == coldim());
+			linbox_check (y.size() == coldim());
+			if (_s.size() == 0)
+				return applyUnscaled (y, x);
+			std::vector<Element> xs (coldim());
+			for (size_t j = 0; j < coldim(); ++j)
+				field().mul (xs[j], _s[j], x[j]);
+			applyUnscaled (y, xs);
+			for (size_t j = 0; j < coldim(); ++j)
+				field().mulin (y[j], _s[j]);
+			return y;
+		}
+
+		/// symmetric
+		template <class OutVector, class InVector>
+		OutVector &applyTranspose (OutVector &y, const InVector &x) const
+		{ return apply (y, x); }
+
+		/** \f$Y = E^T D E X\f$ for a dense block \p X of vectors.
+		 * Still a single traversal of \p E: the \f$N\f$ dot products of a
+		 * row with the columns of \p X are formed together, then scattered.
+		 */
+		template <class Matrix1, class Matrix2>
+		Matrix1 &applyBlock (Matrix1 &Y, const Matrix2 &X) const
+		{
+			linbox_check (X.rowdim() == coldim());
+			linbox_check (Y.rowdim() == coldim());
+			linbox_check (Y.coldim() == X.coldim());
+			if (_s.size() == 0)
+				return applyBlockUnscaled (Y, X);
+			const size_t N = X.coldim();
+			BlasMatrix<Field> XS (field(), coldim(), N);
+			for (size_t j = 0; j < coldim(); ++j)
+				for (size_t c = 0; c < N; ++c)
+					field().mul (XS.refEntry (j, c), _s[j], X.getEntry (j, c));
+			applyBlockUnscaled (Y, XS);
+			for (size_t j = 0; j < coldim(); ++j)
+				for (size_t c = 0; c < N; ++c)
+					field().mulin (Y.refEntry (j, c), _s[j]);
+			return Y;
+		}
+
+		size_t rowdim () const { return _E->coldim(); }
+		size_t coldim () const { return _E->coldim(); }
+		const Field& field () const { return _E->field(); }
+
+	protected:
+
+		template <class OutVector, class InVector>
+		OutVector &applyUnscaled (OutVector &y, const InVector &x) const
+		{
+#ifdef __LINBOX_USE_OPENMP
+			if (_E->size() > ParallelThreshold && omp_get_max_threads() > 1)
+				return applyParallel (y, x);
+#endif
+			for (size_t j = 0; j < coldim(); ++j)
+				field().assign (y[j], field().zero);
+			Element t;
+			for (size_t i = 0; i < _E->rowdim(); ++i)
+				scatterRow (y, i, rowDot (t, i, x));
+			return y;
+		}
+
+		template <class Matrix1, class Matrix2>
+		Matrix1 &applyBlockUnscaled (Matrix1 &Y, const Matrix2 &X) const
+		{
+			const size_t N = X.coldim();
+#ifdef __LINBOX_USE_OPENMP
+			if (_E->size() * N > ParallelThreshold && omp_get_max_threads() > 1)
+				return applyBlockParallel (Y, X);
+#endif
+			for (size_t j = 0; j < coldim(); ++j)
+				for (size_t c = 0; c < N; ++c)
+					field().assign (Y.refEntry (j, c), field().zero);
+			std::vector<FieldAXPY<Field> > acc (N, FieldAXPY<Field> (field()));
+			std::vector<Element> t (N);
+			for (size_t i = 0; i < _E->rowdim(); ++i) {
+				rowDotBlock (t, acc, i, X);
+				for (size_t k = _E->getStart(i); k < _E->getEnd(i); ++k)
+					for (size_t c = 0; c < N; ++c)
+						field().axpyin (Y.refEntry (_E->getColid(k), c), _E->getData(k), t[c]);
+			}
+			return Y;
+		}
+
+		//! t = d_i (row i . x)
+		template <class InVector>
+		Element &rowDot (Element &t, size_t i, const InVector &x) const
+		{
+			FieldAXPY<Field> acc (field());
+			for (size_t k = _E->getStart(i); k < _E->getEnd(i); ++k)
+				acc.mulacc (_E->getData(k), x[_E->getColid(k)]);
+			acc.get (t);
+			if (_d.size())
+				field().mulin (t, _d[i]);
+			return t;
+		}
+
+		//! t_c = d_i (row i . X_c), for all the columns of X
+		template <class Matrix2>
+		void rowDotBlock (std::vector<Element> &t, std::vector<FieldAXPY<Field> > &acc,
+				  size_t i, const Matrix2 &X) const
+		{
+			const size_t N = t.size();
+			for (size_t c = 0; c < N; ++c)
+				acc[c].reset();
+			for (size_t k = _E->getStart(i); k < _E->getEnd(i); ++k)
+				for (size_t c = 0; c < N; ++c)
+					acc[c].mulacc (_E->getData(k), X.getEntry (_E->getColid(k), c));
+			for (size_t c = 0; c < N; ++c) {
+				acc[c].get (t[c]);
+				if (_d.size())
+					field().mulin (t[c], _d[i]);
+			}
+		}
+
+		//! y += t row i
+		template <class OutVector>
+		void scatterRow (OutVector &y, size_t i, const Element &t) const
+		{
+			if (field().isZero (t)) return;
+			for (size_t k = _E->getStart(i); k < _E->getEnd(i); ++k)
+				field().axpyin (y[_E->getColid(k)], _E->getData(k), t);
+		}
+
+#ifdef __LINBOX_USE_OPENMP
+		template <class OutVector, class InVector>
+		OutVector &applyParallel (OutVector &y, const InVector &x) const
+		{
+			std::vector<std::vector<Element> > acc ((size_t)omp_get_max_threads());
+#pragma omp parallel
+			{
+				const size_t nt = (size_t)omp_get_num_threads();
+				std::vector<Element>& mine = acc[(size_t)omp_get_thread_num()];
+				mine.assign (coldim(), field().zero);
+				Element t;
+#pragma omp for schedule(static)
+				for (long i = 0; i < (long)_E->rowdim(); ++i)
+					scatterRow (mine, (size_t)i, rowDot (t, (size_t)i, x));
+#pragma omp for schedule(static)
+				for (long j = 0; j < (long)coldim(); ++j) {
+					field().assign (y[(size_t)j], acc[0][(size_t)j]);
+					for (size_t s = 1; s < nt; ++s)
+						field().addin (y[(size_t)j], acc[s][(size_t)j]);
+				}
+			}
+			return y;
+		}
+
+		//! per-thread n x N accumulators, as in applyParallel
+		template <class Matrix1, class Matrix2>
+		Matrix1 &applyBlockParallel (Matrix1 &Y, const Matrix2 &X) const
+		{
+			const size_t N = X.coldim();
+			std::vector<std::vector<Element> > acc ((size_t)omp_get_max_threads());
+#pragma omp parallel
+			{
+				const size_t nt = (size_t)omp_get_num_threads();
+				std::vector<Element>& mine = acc[(size_t)omp_get_thread_num()];
+				mine.assign (coldim() * N, field().zero);
+				std::vector<FieldAXPY<Field> > dots (N, FieldAXPY<Field> (field()));
+				std::vector<Element> t (N);
+#pragma omp for schedule(static)
+				for (long i = 0; i < (long)_E->rowdim(); ++i) {
+					rowDotBlock (t, dots, (size_t)i, X);
+					for (size_t k = _E->getStart((size_t)i); k < _E->getEnd((size_t)i); ++k) {
+						Element *row = &mine[_E->getColid(k) * N];
+						for (size_t c = 0; c < N; ++c)
+							field().axpyin (row[c], _E->getData(k), t[c]);
+					}
+				}
+#pragma omp for schedule(static)
+				for (long j = 0; j < (long)coldim(); ++j)
+					for (size_t c = 0; c < N; ++c) {
+						Element &y = Y.refEntry ((size_t)j, c);
+						field().assign (y, acc[0][(size_t)j * N + c]);
+						for (size_t s = 1; s < nt; ++s)
+							field().addin (y, acc[s][(size_t)j * N + c]);
+					}
+			}
+			return Y;
+		}
+#endif
+
+		std::shared_ptr<const FusedSparse<Field> > _E;
+		BlasVector<Field>  _d; //!< empty when D = I
+		BlasVector<Field>  _s; //!< empty when S = I
+	};
+
+	/** Whether \p Blackbox can be the leaf of a fused expression.
+	 * Local for the sparse formats enumerated by \c FusedEntries, Generic
+	 * otherwise.
+	 */
+	template <class Blackbox>
+	struct FusedSparseCategory { typedef SolutionTags::Generic Tag; };
+
+	template <class Field>
+	struct FusedSparseCategory<SparseMatrix<Field, SparseMatrixFormat::SparseSeq> > { typedef SolutionTags::Local Tag; };
+
+	template <class Field>
+	struct FusedSparseCategory<SparseMatrix<Field, SparseMatrixFormat::SparsePar> > { typedef SolutionTags::Local Tag; };
+
+	template <class Field>
+	struct FusedSparseCategory<SparseMatrix<Field, SparseMatrixFormat::SparseMap> > { typedef SolutionTags::Local Tag; };
+
+	template <class Field>
+	struct FusedSparseCategory<SparseMatrix<Field, SparseMatrixFormat::CSR> > { typedef SolutionTags::Local Tag; };
+
+	template <class Field>
+	struct FusedSparseCategory<SparseMatrix<Field, SparseMatrixFormat::ELL> > { typedef SolutionTags::Local Tag; };
+
+	template <class Field>
+	struct FusedSparseCategory<SparseMatrix<Field, SparseMatrixFormat::TPL> > { typedef SolutionTags::Local Tag; };
+
+#ifdef _OPENMP
+	template <class Field>
+	struct FusedSparseCategory<SparseMatrix<Field, SparseMatrixFormat::TPL_omp> > { typedef SolutionTags::Local Tag; };
+#endif
+
+	/** \brief \f$D_1 A D_2\f$, for diagonal \f$D_1, D_2\f$, sharing the entries of \p A.
+	 * \ingroup blackbox
+	 *
+	 * The scalings are applied to the vectors, so that operators with
+	 * other scalings reuse the same \c FusedSparse.
+	 */
+	template <class _Field>
+	class FusedScaled : public BlackboxInterface {
+	public:
+		typedef _Field Field;
+		typedef typename Field::Element Element;
+		typedef FusedScaled<Field> Self_t;
+
+		FusedScaled (const Diagonal<Field>& D1, const std::shared_ptr<const FusedSparse<Field> >& A,
+			     const Diagonal<Field>& D2) :
+			_A(A), _r(D1.getData()), _c(D2.getData())
+		{
+			linbox_check (D1.coldim() == A->rowdim());
+			linbox_check (A->coldim() == D2.rowdim());
+		}
+
+		/// y = D1 A D2 x
+		template <class OutVector, class InVector>
+		OutVector &apply (OutVector &y, const InVector &x) const
+		{
+			linbox_check (x.size() == coldim());
+			linbox_check (y.size() == rowdim());
+			std::vector<Element> xs (coldim());
+			for (size_t j = 0; j < coldim(); ++j)
+				field().mul (xs[j], _c[j], x[j]);
+			_A->apply (y, xs);
+			for (size_t i = 0; i < rowdim(); ++i)
+				field().mulin (y[i], _r[i]);
+			return y;
+		}
+
+		/// y = D2 A^T D1 x
+		template <class OutVector, class InVector>
+		OutVector &applyTranspose (OutVector &y, const InVector &x) const
+		{
+			linbox_check (x.size() == rowdim());
+			linbox_check (y.size() == coldim());
+			std::vector<Element> xs (rowdim());
+			for (size_t i = 0; i < rowdim(); ++i)
+				field().mul (xs[i], _r[i], x[i]);
+			_A->applyTranspose (y, xs);
+			for (size_t j = 0; j < coldim(); ++j)
+				field().mulin (y[j], _c[j]);
+			return y;
+		}
+
+		size_t rowdim () const { return _A->rowdim(); }
+		size_t coldim () const { return _A->coldim(); }
+		const Field& field () const { return _A->field(); }
+
+		Element &getEntry (Element &x, size_t i, size_t j) const
+		{
+			_A->getEntry (x, i, j);
+			field().mulin (x, _r[i]);
+			return field().mulin (x, _c[j]);
+		}
+
+		Element &trace (Element &t) const
+		{
+			Element x;
+			field().assign (t, field().zero);
+			for (size_t i = 0; i < std::min (rowdim(), coldim()); ++i)
+				field().addin (t, getEntry (x, i, i));
+			return t;
+		}
+
+	protected:
+		std::shared_ptr<const FusedSparse<Field> > _A;
+		BlasVector<Field> _r, _c;
+	};
+
+	template <class Field>
+	struct GetEntryCategory<FusedScaled<Field> > { typedef SolutionTags::Local Tag; };
+
+	template <class Field>
+	struct TraceCategory<FusedScaled<Field> > { typedef SolutionTags::Local Tag; };
+
+	/*! @name Preconditioned operators.
+	 * \c op() is the product as a \c FusedScaled or \c FusedNormal of
+	 * the \c FusedSparse of \p A when the matrix allows it, as nested
+	 * \c Compose otherwise. The matrix is given as a \c FusedOperand:
+	 * operators built from the same \c FusedOperand, as in successive
+	 * attempts with new preconditioners, share its \c FusedSparse.
+	 */
+	//@{
+
+	/// A, as a FusedSparse built once when the matrix allows it
+	template <class Blackbox, class Tag = typename FusedSparseCategory<Blackbox>::Tag>
+	struct FusedOperand {
+		FusedOperand (const Blackbox& A) : _A(A) {}
+
+		const Blackbox& matrix () const { return _A; }
+
+	protected:
+		const Blackbox& _A;
+	};
+
+	template <class Blackbox>
+	struct FusedOperand<Blackbox, SolutionTags::Local> {
+		typedef typename Blackbox::Field Field;
+
+		FusedOperand (const Blackbox& A) : _A(A), _csr(new FusedSparse<Field> (fused (A))) {}
+
+		const Blackbox& matrix () const { return _A; }
+		const std::shared_ptr<const FusedSparse<Field> >& csr () const { return _csr; }
+
+	protected:
+		const Blackbox& _A;
+		std::shared_ptr<const FusedSparse<Field> > _csr;
+	};
+
+	/// D1 A D2
+	template <class Blackbox, class Tag = typename FusedSparseCategory<Blackbox>::Tag>
+	struct DiagonalScaled {
+		typedef typename Blackbox::Field Field;
+		typedef Compose<Compose<Diagonal<Field>, Blackbox>, Diagonal<Field> > Operator;
+
+		DiagonalScaled (const Diagonal<Field>& D1, const FusedOperand<Blackbox>& A, const Diagonal<Field>& D2) :
+			_DA(&D1, &A.matrix()), _B(&_DA, &D2)
+		{}
+
+		const Operator& op () const { return _B; }
+
+	protected:
+		Compose<Diagonal<Field>, Blackbox> _DA;
+		Operator _B;
+	};
+
+	template <class Blackbox>
+	struct DiagonalScaled<Blackbox, SolutionTags::Local> {
+		typedef typename Blackbox::Field Field;
+		typedef FusedScaled<Field> Operator;
+
+		DiagonalScaled (const Diagonal<Field>& D1, const FusedOperand<Blackbox>& A, const Diagonal<Field>& D2) :
+			_B(D1, A.csr(), D2)
+		{}
+
+		const Operator& op () const { return _B; }
+
+	protected:
+		Operator _B;
+	};
+
+	/// D1 A^T D2 A D1
+	template <class Blackbox, class Tag = typename FusedSparseCategory<Blackbox>::Tag>
+	struct ScaledNormal {
+		typedef typename Blackbox::Field Field;
+		typedef Compose<Blackbox, Diagonal<Field> > AD;
+		typedef Compose<Compose<Transpose<AD>, Diagonal<Field> >, AD> Operator;
+
+		ScaledNormal (const FusedOperand<Blackbox>& A, const Diagonal<Field>& D1, const Diagonal<Field>& D2) :
+			_AD(&A.matrix(), &D1), _ADT(&_AD), _ADTD(&_ADT, &D2), _B(&_ADTD, &_AD)
+		{}
+
+		const Operator& op () const { return _B; }
+
+	protected:
+		AD _AD;
+		Transpose<AD> _ADT;
+		Compose<Transpose<AD>, Diagonal<Field> > _ADTD;
+		Operator _B;
+	};
+
+	template <class Blackbox>
+	struct ScaledNormal<Blackbox, SolutionTags::Local> {
+		typedef typename Blackbox::Field Field;
+		typedef FusedNormal<Field> Operator;
+
+		ScaledNormal (const FusedOperand<Blackbox>& A, const Diagonal<Field>& D1, const Diagonal<Field>& D2) :
+			_B(A.csr(), D2.getData(), D1.getData())
+		{}
+
+		const Operator& op () const { return _B; }
+
+	protected:
+		Operator _B;
+	};
+
+	/// D1 (P A)^T D2 (P A) D1
+	template <class Blackbox, class Tag = typename FusedSparseCategory<Blackbox>::Tag>
+	struct PermutedScaledNormal {
+		typedef typename Blackbox::Field Field;
+		typedef Compose<Compose<Permutation<Field>, Blackbox>, Diagonal<Field> > PAD;
+		typedef Compose<Compose<Transpose<PAD>, Diagonal<Field> >, PAD> Operator;
+
+		PermutedScaledNormal (const Permutation<Field>& P, const FusedOperand<Blackbox>& A,
+				      const Diagonal<Field>& D1, const Diagonal<Field>& D2) :
+			_PA(&P, &A.matrix()), _PAD(&_PA, &D1), _PADT(&_PAD), _PADTD(&_PADT, &D2), _B(&_PADTD, &_PAD)
+		{}
+
+		const Operator& op () const { return _B; }
+
+	protected:
+		Compose<Permutation<Field>, Blackbox> _PA;
+		PAD _PAD;
+		Transpose<PAD> _PADT;
+		Compose<Transpose<PAD>, Diagonal<Field> > _PADTD;
+		Operator _B;
+	};
+
+	/** (P A)^T D2 (P A) = A^T (P^T D2 P) A: the permutation only moves
+	 * the entries of D2, the rows of A are not.
+	 */
+	template <class Blackbox>
+	struct PermutedScaledNormal<Blackbox, SolutionTags::Local> {
+		typedef typename Blackbox::Field Field;
+		typedef FusedNormal<Field> Operator;
+
+		PermutedScaledNormal (const Permutation<Field>& P, const FusedOperand<Blackbox>& A,
+				      const Diagonal<Field>& D1, const Diagonal<Field>& D2) :
+			_B(A.csr(), permuted (P, D2.getData()), D1.getData())
+		{}
+
+		const Operator& op () const { return _B; }
+
+	protected:
+		//! row i of P A is row P[i] of A
+		static BlasVector<Field> permuted (const Permutation<Field>& P, const BlasVector<Field>& d)
+		{
+			linbox_check (P.rowdim() == d.size());
+			BlasVector<Field> e (d.field(), d.size());
+			for (size_t i = 0; i < d.size(); ++i)
+				d.field().assign (e[P[i]], d[i]);
+			return e;
+		}
+
+		Operator _B;
+	};
+	//@}
+
+} // namespace LinBox
+
+#endif // __LINBOX_fused_sparse_H
+
+// Local Variables:
+// mode: C++
+// tab-width: 4
+// indent-tabs-mode: nil
+// c-basic-offset: 4
+// End:
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
@@ -25,11 +25,16 @@
 #define __LINBOX_rational_dense_factory_H
 
 #include "linbox/blackbox/factory.h"
+#include "linbox/util/matrix-stream.h"
 //#include "linbox/field/gmp-rational.h"
 #include "givaro/zring.h"
 
 #include <vector>
 
+#ifdef __LINBOX_USE_OPENMP
+#include <omp.h>
+#endif
+
 namespace LinBox
 {
 
@@ -315,6 +320,235 @@ namespace LinBox
 		}
 	};
 
+	/** \brief RationalMatrixFactory in one pass over the matrix.
+	 *
+	 * The nonzero entries are read once, from a rational matrix or from
+	 * a MatrixStream, and kept as numerators and denominators by rows.
+	 * The common denominators of the rows, of the columns and of the
+	 * matrix, the norms and omega are then computed on all the threads,
+	 * by rows, each thread with its own GMP temporaries and column
+	 * denominators, merged at the end. makeAprim and makeAtilde scale
+	 * the rows in parallel as well and only set the nonzero entries of
+	 * the target, dense or sparse.
+	 */
+	template<class Rationals>
+	class StreamingRationalMatrixFactory {
+		typedef typename Rationals::Element Quotient;
+
+		struct Entry {
+			size_t  col;
+			Integer num, den;
+		};
+
+		const Rationals _ratField;
+		size_t _m, _n;
+		std::vector<std::vector<Entry> > _rows;
+		std::vector<Integer> _denAi, _denAj;
+		Integer _denA, _ratNorm, _normAprim, _normAtilde;
+		size_t  _omega, _ratOmega;
+
+	public:
+
+		//! reads the entries of \p A with getEntry
+		template<class QMatrix>
+		StreamingRationalMatrixFactory(const QMatrix& A) :
+			_ratField(A.field()), _m(A.rowdim()), _n(A.coldim()), _rows(_m)
+		{
+			Quotient a;
+			for (size_t i = 0; i < _m; ++i)
+				for (size_t j = 0; j < _n; ++j)
+					_push(i, j, A.getEntry(a, i, j));
+			_analyse();
+		}
+
+		/** reads the triples of \p ms, which may come in any order.
+		 * @throws MatrixStreamError on a read error or an entry out of
+		 * the dimensions of \p ms
+		 */
+		StreamingRationalMatrixFactory(MatrixStream<Rationals>& ms) :
+			_ratField(ms.field()), _m(0), _n(0)
+		{
+			if (!ms.getDimensions(_m, _n))
+				throw ms.reportError(__FUNCTION__, __LINE__);
+			_rows.resize(_m);
+			size_t i, j;
+			Quotient a;
+			while (ms.nextTriple(i, j, a)) {
+				if (i >= _m || j >= _n) {
+					std::cerr << std::endl
+						<< "ERROR (" << __FUNCTION__ << ":" << __LINE__ << "): "
+						<< "Problem reading matrix:" << std::endl
+						<< "Entry (" << i << ", " << j << ") out of a "
+						<< _m << " x " << _n << " matrix." << std::endl
+						<< "At line number: " << ms.getLineNumber() << std::endl;
+					throw BAD_FORMAT;
+				}
+				_push(i, j, a);
+			}
+			if (ms.getError() > END_OF_MATRIX)
+				throw ms.reportError(__FUNCTION__, __LINE__);
+			_analyse();
+		}
+
+		size_t rowdim() const { return _m; }
+		size_t coldim() const { return _n; }
+
+		//! common denominator of the matrix
+		Integer& denominator(Integer& da) const { return da = _denA; }
+
+		//! common denominator of the row \p i
+		Integer& denominator(Integer& di, const int i) const { return di = _denAi[(size_t)i]; }
+
+		//! common denominator of the column \p j
+		Integer& columnDenominator(Integer& dj, const size_t j) const { return dj = _denAj[j]; }
+
+		//! as RationalMatrixFactory::getNorms
+		Integer getNorms(Integer& ratnorm, Integer& normaprim, Integer& normatilde) const
+		{
+			ratnorm = _ratNorm; normaprim = _normAprim; normatilde = _normAtilde;
+			return (_ratNorm > _normAtilde) ? _normAtilde : _ratNorm;
+		}
+
+		//! number of nonzero entries, \p ro of them not integers
+		size_t getOmega(size_t& o, size_t& ro) const
+		{
+			ro = _ratOmega;
+			return o = _omega;
+		}
+
+		/*
+		 * Sets the nonzero entries of Aprim = _denA * A,
+		 * Aprim is zero and of the dimensions of A
+		 */
+		template <class Matrix>
+		Matrix& makeAprim(Matrix& Aprim) const { return _scale(Aprim, false); }
+
+		/*
+		 * Sets the nonzero entries of Atilde = diag(_denAi[i]) * A,
+		 * Atilde is zero and of the dimensions of A
+		 */
+		template <class Matrix>
+		Matrix& makeAtilde(Matrix& Atilde) const { return _scale(Atilde, true); }
+
+	private:
+
+		void _push(size_t i, size_t j, const Quotient& a)
+		{
+			Entry e;
+			_ratField.get_num(e.num, a);
+			if (e.num == 0) return;
+			_ratField.get_den(e.den, a);
+			e.col = j;
+			_rows[i].push_back(e);
+		}
+
+		void _analyse()
+		{
+			const long m = (long)_m;
+			_denAi.assign(_m, 1);
+			_denAj.assign(_n, 1);
+			_denA = 1;
+			_ratNorm = 0; _normAprim = 0; _normAtilde = 0;
+			_omega = 0; _ratOmega = 0;
+
+			// row and column denominators, rational norm and omega
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel
+#endif
+			{
+				std::vector<Integer> cols(_n, 1);
+				Integer norm = 0, t;
+				size_t o = 0, ro = 0;
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp for schedule(dynamic, 16)
+#endif
+				for (long i = 0; i < m; ++i) {
+					const std::vector<Entry>& R = _rows[(size_t)i];
+					Integer& di = _denAi[(size_t)i];
+					for (size_t k = 0; k < R.size(); ++k) {
+						lcm(di, di, R[k].den);
+						lcm(cols[R[k].col], cols[R[k].col], R[k].den);
+						t = abs(R[k].num);
+						if (t > norm) norm = t;
+						if (R[k].den > norm) norm = R[k].den;
+						if (R[k].den != 1) ++ro;
+					}
+					o += R.size();
+				}
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp critical(rational_matrix_factory)
+#endif
+				{
+					for (size_t j = 0; j < _n; ++j)
+						if (cols[j] != 1) lcm(_denAj[j], _denAj[j], cols[j]);
+					if (norm > _ratNorm) _ratNorm = norm;
+					_omega += o;
+					_ratOmega += ro;
+				}
+			}
+			for (size_t i = 0; i < _m; ++i)
+				lcm(_denA, _denA, _denAi[i]);
+
+			// norms of Aprim and Atilde
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel
+#endif
+			{
+				Integer nprim = 0, ntilde = 0, t;
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp for schedule(dynamic, 16)
+#endif
+				for (long i = 0; i < m; ++i) {
+					const std::vector<Entry>& R = _rows[(size_t)i];
+					for (size_t k = 0; k < R.size(); ++k) {
+						t = _denAi[(size_t)i] / R[k].den;
+						t *= abs(R[k].num);
+						if (t > ntilde) ntilde = t;
+						t = _denA / R[k].den;
+						t *= abs(R[k].num);
+						if (t > nprim) nprim = t;
+					}
+				}
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp critical(rational_matrix_factory)
+#endif
+				{
+					if (nprim > _normAprim) _normAprim = nprim;
+					if (ntilde > _normAtilde) _normAtilde = ntilde;
+				}
+			}
+		}
+
+		// the scaled rows are computed in parallel, then set
+		template <class Matrix>
+		Matrix& _scale(Matrix& B, bool byRows) const
+		{
+			const long m = (long)_m;
+			std::vector<std::vector<Integer> > S(_m);
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for schedule(dynamic, 16)
+#endif
+			for (long i = 0; i < m; ++i) {
+				const std::vector<Entry>& R = _rows[(size_t)i];
+				const Integer& d = byRows ? _denAi[(size_t)i] : _denA;
+				std::vector<Integer>& Si = S[(size_t)i];
+				Si.resize(R.size());
+				for (size_t k = 0; k < R.size(); ++k) {
+					Si[k] = d / R[k].den;
+					Si[k] *= R[k].num;
+				}
+			}
+
+			typename Matrix::Field::Element x;
+			for (size_t i = 0; i < _m; ++i)
+				for (size_t k = 0; k < S[i].size(); ++k) {
+					B.field().init(x, S[i][k]);
+					B.setEntry(i, _rows[i][k].col, x);
+				}
+			return B;
+		}
+	};
+
 } // namespace LinBox
 
 
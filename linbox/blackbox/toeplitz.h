@@ -144,6 +144,7 @@ namespace LinBox
 	 * Computations on the matrix will be performed using this polynomial ring.
 	 * The apply is a call to polynomial multiplication and if the poly ring is
 	 * FFT based for large n, apply will run in O(n lg(n)) time.
+	 * @see FFTToeplitz for word size prime fields without NTL.
 	 */
 #ifdef __LINBOX_HAVE_NTL
 	template< class _CField, class _PRing = NTL_ZZ_pX >
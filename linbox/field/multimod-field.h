@@ -45,6 +45,10 @@
 #include <cmath>
 #include <vector>
 
+#ifndef __LINBOX_MULTIMOD_PAR_THRESHOLD
+//! minimal number of residues (over all moduli) for a threaded batch operation
+#define __LINBOX_MULTIMOD_PAR_THRESHOLD 65536
+#endif
 
 
 
@@ -63,6 +67,23 @@ namespace LinBox
 		typedef RingCategories::ModularTag categoryTag;
 	};
 
+	/** Multimodular field over several word-size primes.
+	 *
+	 * An element is the vector of its residues, one per modulus. The
+	 * moduli and their inverses are kept in contiguous arrays so that the
+	 * element-wise operations below are plain loops over the moduli which
+	 * the compiler vectorises (several moduli per SIMD instruction).
+	 *
+	 * The \c *Batch members work on structure-of-arrays storage: \c size()
+	 * planes of \p n residues each, plane \c k (modulo \c getModulo(k))
+	 * starting at offset <code>k*ldp</code>. This is the layout of
+	 * <code>BlasMatrix<MultiModDouble></code> and of \c create_MatrixRNS.
+	 * The batched kernels serve <code>BlasMatrixDomain<MultiModDouble></code>;
+	 * the only other user of the planes is the RNS apply of
+	 * \c BlasMatrixApplyDomain, taken by the Dixon lifting modulo a prime
+	 * above 32 bits. The determinants and the other solvers work modulo
+	 * one prime at a time and do not go through this class.
+	 */
 	class MultiModDouble : public FieldInterface {
 
 	protected:
@@ -72,6 +93,8 @@ namespace LinBox
 		std::vector<integer>                 _crt_constant;
 		std::vector<double >                  _crt_inverse;
 		integer                                _crt_modulo;
+		std::vector<double>                        _primes;
+		std::vector<double>                     _invprimes;
 
 
 	public:
@@ -83,51 +106,39 @@ namespace LinBox
 		typedef std::vector<double>              Element;
 		typedef MultiModRandIter                RandIter;
 
+		Element one, zero, mOne;
+
 		MultiModDouble () :
 		       	_size(0)
 		{}
 
 		MultiModDouble (const std::vector<integer> &primes) :
 			_fields(primes.size()), _size(primes.size()),
-			_crt_constant(primes.size()), _crt_inverse(primes.size())
+			_crt_constant(primes.size()), _crt_inverse(primes.size()),
+			_primes(primes.size()), _invprimes(primes.size())
 		{
-			_crt_modulo=1;
-			for (size_t i=0; i<_size; ++i){
-				_fields[i] = ( Givaro::Modular<double> (primes[i]) );
-				_crt_modulo *= primes[i];
-			}
-			double tmp;
-			for (size_t i=0; i<_size; ++i){
-				_crt_constant[i]= _crt_modulo/(integer)primes[i];
-				_fields[i].init(tmp, _crt_constant[i]);
-				_fields[i].inv(_crt_inverse[i],tmp);
-			}
-
+			for (size_t i=0; i<_size; ++i)
+				_primes[i] = (double) primes[i];
+			setup();
 		}
 
 
 		MultiModDouble (const std::vector<double> &primes) :
 			_fields(primes.size()), _size(primes.size()),
-			_crt_constant(primes.size()), _crt_inverse(primes.size())
+			_crt_constant(primes.size()), _crt_inverse(primes.size()),
+			_primes(primes), _invprimes(primes.size())
 		{
-			_crt_modulo=1;
-			for (size_t i=0; i<_size; ++i){
-				_fields[i] = ( Givaro::Modular<double> (primes[i]) );
-				_crt_modulo *= primes[i];
-			}
-			double tmp;
-			for (size_t i=0; i<_size; ++i){
-				_crt_constant[i]= _crt_modulo/(integer)primes[i];
-				_fields[i].init(tmp, _crt_constant[i]);
-				_fields[i].inv(_crt_inverse[i],tmp);
-			}
+			setup();
 		}
 
 
 		MultiModDouble(const MultiModDouble& F) :
 			_fields(F._fields), _size(F._size),
 			_crt_constant(F._crt_constant), _crt_inverse(F._crt_inverse),
-			_crt_modulo(F._crt_modulo) {}
+			_crt_modulo(F._crt_modulo),
+			_primes(F._primes), _invprimes(F._invprimes),
+			one(F.one), zero(F.zero), mOne(F.mOne)
+		{}
 
 		MultiModDouble &operator=(const MultiModDouble &F)
 		{
@@ -136,6 +147,11 @@ namespace LinBox
 			_crt_constant = F._crt_constant;
 			_crt_modulo   = F._crt_modulo;
 			_crt_inverse  = F._crt_inverse;
+			_primes       = F._primes;
+			_invprimes    = F._invprimes;
+			one           = F.one;
+			zero          = F.zero;
+			mOne          = F.mOne;
 			return *this;
 		}
 
@@ -149,6 +165,10 @@ namespace LinBox
 		Givaro::Modular<double>::Residu_t getModulo(size_t i) const
 		{ return this->_fields[i].characteristic();}
 
+		//! the moduli, contiguous
+		const double* getModuli() const
+		{ return _primes.data(); }
+
 
 		const integer& getCRTmodulo() const
 		{return _crt_modulo;}
@@ -168,14 +188,22 @@ namespace LinBox
 		}
 
 		integer &convert (integer &x, const Element &y) const
+		{
+			return convert(x, y.data(), 1);
+		}
+
+		/** CRT reconstruction of the residues <code>y[0], y[ldp], ..., y[(size()-1)*ldp]</code>.
+		 * @return \p x in \f$[0, \prod p_i)\f$
+		 */
+		integer &convert (integer &x, const double *y, size_t ldp) const
 		{
 			x=0;
 			double tmp;
 			for (size_t i=0;i<_size; ++i){
-				_fields[i].mul(tmp, y[i], _crt_inverse[i]);
+				_fields[i].mul(tmp, y[i*ldp], _crt_inverse[i]);
 				integer res= tmp;
 				x= x + ( res*_crt_constant[i]);
-				if (x > _crt_modulo)
+				if (x >= _crt_modulo)
 					x-= _crt_modulo;
 			}
 			return x;
@@ -256,40 +284,44 @@ namespace LinBox
 
 		inline  bool isZero (const Element &x) const
 		{
-			return x == std::vector<double> (_size, 0.);
+			return x == zero;
 		}
 
 		inline bool isOne (const Element &x) const
 		{
-			return x == std::vector<double>(_size, 1.);
+			return x == one;
 		}
 
 		inline bool isMOne (const Element &x) const
 		{
-			return x == std::vector<double>(_size, -1.); // bug
+			return x == mOne;
 		}
 
 		inline Element &add (Element &x, const Element &y, const Element &z) const
 		{
+			const double *p = _primes.data();
 			for (size_t i=0;i<_size;++i) {
-				_fields[i].add(x[i], y[i], z[i]);
+				double s = y[i] + z[i];
+				x[i] = (s >= p[i]) ? s - p[i] : s;
 			}
 			return x;
 		}
 
 		inline Element &sub (Element &x, const Element &y, const Element &z) const
 		{
-			for (size_t i=0;i<_size;++i){
-				_fields[i].sub(x[i], y[i], z[i]);
+			const double *p = _primes.data();
+			for (size_t i=0;i<_size;++i) {
+				double s = y[i] - z[i];
+				x[i] = (s < 0.) ? s + p[i] : s;
 			}
 			return x;
 		}
 
 		inline Element &mul (Element &x, const Element &y, const Element &z) const
 		{
-			for (size_t i=0;i<_size;++i){
-				_fields[i].mul(x[i], y[i], z[i]);
-			}
+			const double *p = _primes.data(), *ip = _invprimes.data();
+			for (size_t i=0;i<_size;++i)
+				x[i] = reduce(y[i]*z[i], p[i], ip[i]);
 			return x;
 		}
 
@@ -303,9 +335,9 @@ namespace LinBox
 
 		inline Element &neg (Element &x, const Element &y) const
 		{
-			for (size_t i=0;i<_size;++i){
-				_fields[i].neg(x[i], y[i]);
-			}
+			const double *p = _primes.data();
+			for (size_t i=0;i<_size;++i)
+				x[i] = (y[i] == 0.) ? 0. : p[i] - y[i];
 			return x;
 		}
 
@@ -322,34 +354,25 @@ namespace LinBox
 				      const Element &x,
 				      const Element &y) const
 		{
-			for (size_t i=0;i<_size;++i){
-				_fields[i].axpy(r[i], a[i], x[i], y[i]);
-			}				\
+			const double *p = _primes.data(), *ip = _invprimes.data();
+			for (size_t i=0;i<_size;++i)
+				r[i] = reduce(a[i]*x[i]+y[i], p[i], ip[i]);
 			return r;
 		}
 
 		inline Element &addin (Element &x, const Element &y) const
 		{
-			for (size_t i=0;i<_size;++i){
-				_fields[i].addin(x[i], y[i]);
-			}
-			return x;
+			return add(x, x, y);
 		}
 
 		inline Element &subin (Element &x, const Element &y) const
 		{
-			for (size_t i=0;i<_size;++i){
-				_fields[i].subin(x[i], y[i]);
-			}
-			return x;
+			return sub(x, x, y);
 		}
 
 		inline Element &mulin (Element &x, const Element &y) const
 		{
-			for (size_t i=0;i<_size;++i){
-				_fields[i].mulin(x[i], y[i]);
-			}
-			return x;
+			return mul(x, x, y);
 		}
 
 		inline Element &divin (Element &x, const Element &y) const
@@ -362,10 +385,7 @@ namespace LinBox
 
 		inline Element &negin (Element &x) const
 		{
-			for (size_t i=0;i<_size;++i){
-				_fields[i].negin(x[i]);
-			}
-			return x;
+			return neg(x, x);
 		}
 
 		inline Element &invin (Element &x) const
@@ -378,15 +398,136 @@ namespace LinBox
 
 		inline Element &axpyin (Element &r, const Element &a, const Element &x) const
 		{
-			for (size_t i=0;i<_size;++i){
-				_fields[i].axpyin(r[i], a[i], x[i]);
+			return axpy(r, a, x, r);
+		}
+
+		/** @name Structure-of-arrays kernels
+		 * \p X, \p Y, \p Z hold \c size() planes of \p n residues, plane \c k
+		 * at offset <code>k*ldp</code>. Inner loops run over contiguous data
+		 * with a fixed modulus and are free of branches, so they vectorise.
+		 */
+		//@{
+		//! X = Y + Z
+		void addBatch (double *X, const double *Y, const double *Z, size_t n, size_t ldp) const
+		{
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for if (_size*n > __LINBOX_MULTIMOD_PAR_THRESHOLD) schedule(static)
+#endif
+			for (long k=0;k<(long)_size;++k) {
+				const double p = _primes[k];
+				double *Xk = X+k*ldp; const double *Yk = Y+k*ldp, *Zk = Z+k*ldp;
+				for (size_t i=0;i<n;++i) {
+					double s = Yk[i] + Zk[i];
+					Xk[i] = (s >= p) ? s - p : s;
+				}
 			}
-			return r;
 		}
 
+		//! X = Y - Z
+		void subBatch (double *X, const double *Y, const double *Z, size_t n, size_t ldp) const
+		{
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for if (_size*n > __LINBOX_MULTIMOD_PAR_THRESHOLD) schedule(static)
+#endif
+			for (long k=0;k<(long)_size;++k) {
+				const double p = _primes[k];
+				double *Xk = X+k*ldp; const double *Yk = Y+k*ldp, *Zk = Z+k*ldp;
+				for (size_t i=0;i<n;++i) {
+					double s = Yk[i] - Zk[i];
+					Xk[i] = (s < 0.) ? s + p : s;
+				}
+			}
+		}
+
+		//! X = Y * Z (pointwise)
+		void mulBatch (double *X, const double *Y, const double *Z, size_t n, size_t ldp) const
+		{
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for if (_size*n > __LINBOX_MULTIMOD_PAR_THRESHOLD) schedule(static)
+#endif
+			for (long k=0;k<(long)_size;++k) {
+				const double p = _primes[k], ip = _invprimes[k];
+				double *Xk = X+k*ldp; const double *Yk = Y+k*ldp, *Zk = Z+k*ldp;
+				for (size_t i=0;i<n;++i)
+					Xk[i] = reduce(Yk[i]*Zk[i], p, ip);
+			}
+		}
+
+		//! R = A * X + Y (pointwise), \p R may alias \p Y
+		void axpyBatch (double *R, const double *A, const double *X, const double *Y, size_t n, size_t ldp) const
+		{
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for if (_size*n > __LINBOX_MULTIMOD_PAR_THRESHOLD) schedule(static)
+#endif
+			for (long k=0;k<(long)_size;++k) {
+				const double p = _primes[k], ip = _invprimes[k];
+				double *Rk = R+k*ldp; const double *Ak = A+k*ldp, *Xk = X+k*ldp, *Yk = Y+k*ldp;
+				for (size_t i=0;i<n;++i)
+					Rk[i] = reduce(Ak[i]*Xk[i]+Yk[i], p, ip);
+			}
+		}
+
+		//! X *= a, with one scalar per modulus
+		void scalinBatch (double *X, const Element &a, size_t n, size_t ldp) const
+		{
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for if (_size*n > __LINBOX_MULTIMOD_PAR_THRESHOLD) schedule(static)
+#endif
+			for (long k=0;k<(long)_size;++k) {
+				const double p = _primes[k], ip = _invprimes[k], ak = a[k];
+				double *Xk = X+k*ldp;
+				for (size_t i=0;i<n;++i)
+					Xk[i] = reduce(ak*Xk[i], p, ip);
+			}
+		}
+
+		//! x[i] = CRT of the residues of the \p i-th entry of every plane
+		integer *convertBatch (integer *x, const double *X, size_t n, size_t ldp) const
+		{
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for if (_size*n > __LINBOX_MULTIMOD_PAR_THRESHOLD) schedule(static)
+#endif
+			for (long i=0;i<(long)n;++i)
+				convert(x[i], X+i, ldp);
+			return x;
+		}
+		//@}
+
 		static inline double maxCardinality()
 		{ return 94906265.0; } // floor( 2^26.5 )
 
+	protected:
+
+		//! r mod p for 0 <= r < 2^53, with ip = 1/p.
+		static inline double reduce (double r, const double p, const double ip)
+		{
+			r -= std::floor(r*ip)*p;
+			r += (r < 0.) ? p : 0.;
+			r -= (r >= p) ? p : 0.;
+			return r;
+		}
+
+		void setup()
+		{
+			_crt_modulo=1;
+			for (size_t i=0; i<_size; ++i){
+				_fields[i] = ( Givaro::Modular<double> (_primes[i]) );
+				_invprimes[i] = 1./_primes[i];
+				_crt_modulo *= (integer)_primes[i];
+			}
+			double tmp;
+			for (size_t i=0; i<_size; ++i){
+				_crt_constant[i]= _crt_modulo/(integer)_primes[i];
+				_fields[i].init(tmp, _crt_constant[i]);
+				_fields[i].inv(_crt_inverse[i],tmp);
+			}
+			init(zero, 0.);
+			init(one, 1.);
+			mOne.resize(_size);
+			for (size_t i=0; i<_size; ++i)
+				mOne[i] = _primes[i] - 1.;
+		}
+
 	};// end of class MultiModField
 
 	class MultiModRandIter {
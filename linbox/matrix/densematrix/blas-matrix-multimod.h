@@ -40,20 +40,23 @@
 
 #include "linbox/util/debug.h"
 
-// #include "linbox/vector/subiterator.h"
-// #include "linbox/vector/subvector.h"
-
 #include "linbox/matrix/matrix-category.h"
 #include "linbox/linbox-tags.h"
+#include "linbox/field/multimod-field.h"
 #include "linbox/matrix/dense-matrix.h"
-
-THIS_CODE_MAY_NOT_COMPILE_AND_IS_NOT_TESTED
+#include "linbox/matrix/matrixdomain/blas-matrix-domain.h"
 
 namespace LinBox
 { /*  Specialisation of BlasMatrix for MultiModDouble field */
 
-	/*! No Doc.
-	*/
+	/*! Dense matrix over a \c MultiModDouble field.
+	 * Storage is structure-of-arrays across moduli: one contiguous buffer
+	 * holding \c field().size() row-major planes of <code>rowdim()*coldim()</code>
+	 * doubles, plane \c k being the matrix modulo <code>field().getModulo(k)</code>.
+	 * This is the layout filled by \c create_MatrixRNS, so each plane can be
+	 * handed to FFLAS directly and all moduli are processed by one call of
+	 * \c BlasMatrixDomain<MultiModDouble>.
+	 */
 	template<>
 	class BlasMatrix<MultiModDouble> {
 
@@ -66,66 +69,71 @@ namespace LinBox
 	protected:
 
 		MultiModDouble                 _field;
-		const std::vector<MatrixDomain<Givaro::Modular<double> > >   _MD;
 		size_t                  _row,_col;
-		Element                _One,_Zero; //! @warning used ?
-		std::vector<BlasMatrix<Givaro::Modular<double> >* > _rep;
-		mutable std::vector<double>       _entry;
+		std::vector<double>           _rep;
+		mutable std::vector<double> _entry;
 	public:
 
 
-		//BlasMatrix () {}
-
 		BlasMatrix (const MultiModDouble& F) :
-			_field(F) , _rep(F.size()), _entry(F.size())
+			_field(F) , _row(0), _col(0), _entry(F.size())
 		{}
 
-		BlasMatrix (const Field& F, size_t m, size_t n, bool alloc=true) :
-			_field(F), _row(m) , _col(n) , _rep(F.size()),  _entry(F.size())
-		{
-			for (size_t i=0;i<_rep.size();++i)
-				_rep[i] =  new BlasMatrix<Givaro::Modular<double> > (F.getBase(i), m, n);
-		}
+		BlasMatrix (const Field& F, size_t m, size_t n) :
+			_field(F), _row(m) , _col(n) , _rep(F.size()*m*n, 0.), _entry(F.size())
+		{}
 
 		BlasMatrix (const BlasMatrix<MultiModDouble> & A):
 			_field(A._field),_row(A._row), _col(A._col),
-			_rep(A._rep.size()), _entry(A._entry)
-		{
-
-			for (size_t i=0;i<_rep.size();++i)
-				_rep[i]= new  BlasMatrix<Givaro::Modular<double> > (const_cast<BlasMatrix<Givaro::Modular<double> >& >( *A._rep[i]));
-		}
+			_rep(A._rep), _entry(A._entry)
+		{}
 
 
 		const BlasMatrix<MultiModDouble>& operator=(const BlasMatrix<MultiModDouble> & A)
 		{
-			_field   = A._field;
-			_row = A._row;
-			_col = A._col;
-			_rep = std::vector<BlasMatrix<Givaro::Modular<double> >* >(A._rep.size());
+			_field = A._field;
+			_row   = A._row;
+			_col   = A._col;
+			_rep   = A._rep;
 			_entry = A._entry;
-			for (size_t i=0;i<_rep.size();++i)
-				_rep[i]= new  BlasMatrix<Givaro::Modular<double> > (const_cast<BlasMatrix<Givaro::Modular<double> >& >( *A._rep[i]));
 			return *this;
 		}
 
+		void resize (size_t m, size_t n)
+		{
+			_row = m;
+			_col = n;
+			_rep.assign(_field.size()*m*n, 0.);
+		}
+
+		//! plane \p k: the matrix modulo the \p k -th prime (row major, stride \c getStride())
+		const double* getPointer(size_t k = 0) const { return _rep.data()+k*planeStride(); }
+		double* getWritePointer(size_t k = 0) { return _rep.data()+k*planeStride(); }
 
-		~BlasMatrix() {for (size_t i=0; i< _rep.size();++i) {delete _rep[i];} }
+		//! row stride inside a plane
+		size_t getStride() const { return _col; }
+
+		//! distance between two consecutive planes
+		size_t planeStride() const { return _row*_col; }
 
 		template <class Vector1, class Vector2>
 		Vector1&  apply (Vector1& y, const Vector2& x) const
 		{
-			for (size_t i=0;i<_rep.size();++i) {
-				std::vector<double> x_tmp(x.size()), y_tmp(y.size());
-				for (size_t j=0;j<x.size();++j)
-					x_tmp[j]= x[j][i];
-
-				_rep[i]->apply(y_tmp, x_tmp);
-
-				for (size_t j=0;j<y.size();++j){
-					y[j][i]=y_tmp[j];
-
-				}
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+			for (long k=0;k<(long)_field.size();++k) {
+				const Givaro::Modular<double>& Fk = _field.getBase(k);
+				std::vector<double> x_tmp(_col), y_tmp(_row);
+				for (size_t j=0;j<_col;++j)
+					x_tmp[j]= x[j][k];
+
+				FFLAS::fgemv(Fk, FFLAS::FflasNoTrans, _row, _col,
+					     Fk.one, getPointer(k), getStride(),
+					     x_tmp.data(), 1, Fk.zero, y_tmp.data(), 1);
+
+				for (size_t i=0;i<_row;++i)
+					y[i][k]=y_tmp[i];
 			}
 
 			return y;
@@ -134,35 +142,26 @@ namespace LinBox
 		template <class Vector1, class Vector2>
 		Vector1&  applyTranspose (Vector1& y, const Vector2& x) const
 		{
-			for (size_t i=0;i<_rep.size();++i) {
-				std::vector<double> x_tmp(x.size()), y_tmp(y.size());
-				for (size_t j=0;j<x.size();++j)
-					x_tmp[i]= x[j][i];
-
-				_rep[i]->applyTranspose(y_tmp, x_tmp);
-
-				for (size_t j=0;j<y.size();++j)
-					y[j][i]=y_tmp[i];
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+			for (long k=0;k<(long)_field.size();++k) {
+				const Givaro::Modular<double>& Fk = _field.getBase(k);
+				std::vector<double> x_tmp(_row), y_tmp(_col);
+				for (size_t i=0;i<_row;++i)
+					x_tmp[i]= x[i][k];
+
+				FFLAS::fgemv(Fk, FFLAS::FflasTrans, _row, _col,
+					     Fk.one, getPointer(k), getStride(),
+					     x_tmp.data(), 1, Fk.zero, y_tmp.data(), 1);
+
+				for (size_t j=0;j<_col;++j)
+					y[j][k]=y_tmp[j];
 			}
 
 			return y;
 		}
 
-#if 0
-		template<typename _Tp1>
-		struct rebind
-		{
-			typedef BlasMatrix<_Tp1> other;
-
-			void operator() (other *& Ap, const Self_t& A, const _Tp1& F) {
-				Ap = new other(F, A.rowdim(), A.coldim());
-				Hom<Field, _Tp1> hom(A. field(), F);
-
-				hom.image (*Ap_p, *A_p);
-			}
-		};
-#endif
-
 		size_t rowdim() const {return _row;}
 
 		size_t coldim() const {return _col;}
@@ -173,28 +172,40 @@ namespace LinBox
 
 		std::ostream& write(std::ostream& os) const
 		{
-			for (size_t i=0;i<_rep.size();++i)
-				_rep[i]->write(os);
+			for (size_t k=0;k<_field.size();++k) {
+				for (size_t i=0;i<_row;++i) {
+					for (size_t j=0;j<_col;++j)
+						os << getPointer(k)[i*_col+j] << ' ';
+					os << std::endl;
+				}
+				os << std::endl;
+			}
 			return os;
 		}
 
 
-		const Element& setEntry (size_t , size_t j, const Element &a_ij)
+		const Element& setEntry (size_t i, size_t j, const Element &a_ij)
 		{
-			for (size_t i=0; i< _rep.size();++i)
-				_rep[i]->setEntry(i,j,a_ij[i]);
-            return a_ij;
+			for (size_t k=0; k< _field.size();++k)
+				getWritePointer(k)[i*_col+j] = a_ij[k];
+			return a_ij;
 		}
 
 
-		const Element& getEntry (size_t , size_t j) const
+		const Element& getEntry (size_t i, size_t j) const
 		{
-			for (size_t i=0; i< _rep.size();++i)
-				_entry[i]=_rep[i]->getEntry(i,j);
+			for (size_t k=0; k< _field.size();++k)
+				_entry[k]=getPointer(k)[i*_col+j];
 			return _entry;
 		}
 
-		BlasMatrix<Givaro::Modular<double> >*& getMatrix(size_t i) {return _rep[i];}
+		Element& getEntry (Element &x, size_t i, size_t j) const
+		{
+			x.resize(_field.size());
+			for (size_t k=0; k< _field.size();++k)
+				x[k]=getPointer(k)[i*_col+j];
+			return x;
+		}
 
 	};
 
@@ -204,9 +215,126 @@ namespace LinBox
 	public:
 		typedef MatrixContainerCategory::Blackbox Type;
 	};
+
+	/*! @internal
+	 * Multiplication over all the moduli of a \c MultiModDouble field:
+	 * one \c fgemm per plane, the planes being independent they are
+	 * dispatched to threads.
+	 */
+	template<>
+	class BlasMatrixDomainMulAdd<BlasMatrix<MultiModDouble>, BlasMatrix<MultiModDouble>, BlasMatrix<MultiModDouble> > {
+	public:
+		typedef MultiModDouble Field;
+		typedef BlasMatrix<MultiModDouble> Matrix;
+
+		Matrix& operator() (Matrix                        & D,
+				    const Field::Element          & beta,
+				    const Matrix                  & C,
+				    const Field::Element          & alpha,
+				    const Matrix                  & A,
+				    const Matrix                  & B) const
+		{
+			linbox_check( D.rowdim() == C.rowdim());
+			linbox_check( D.coldim() == C.coldim());
+			D = C;
+			return (*this)(beta, D, alpha, A, B);
+		}
+
+		Matrix& operator() (const Field::Element          & beta,
+				    Matrix                        & C,
+				    const Field::Element          & alpha,
+				    const Matrix                  & A,
+				    const Matrix                  & B) const
+		{
+			linbox_check( A.coldim() == B.rowdim());
+			linbox_check( C.rowdim() == A.rowdim());
+			linbox_check( C.coldim() == B.coldim());
+			linbox_check( A.field().size() == C.field().size());
+			linbox_check( B.field().size() == C.field().size());
+
+			const Field& F = C.field();
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+			for (long k=0;k<(long)F.size();++k)
+				FFLAS::fgemm( F.getBase(k), FFLAS::FflasNoTrans, FFLAS::FflasNoTrans,
+					      C.rowdim(), C.coldim(), A.coldim(),
+					      alpha[k],
+					      A.getPointer(k), A.getStride(),
+					      B.getPointer(k), B.getStride(),
+					      beta[k],
+					      C.getWritePointer(k), C.getStride());
+			return C;
+		}
+	};
+
+	//! C = A+B over all the moduli
+	template<>
+	class BlasMatrixDomainAdd<MultiModDouble, BlasMatrix<MultiModDouble>, BlasMatrix<MultiModDouble>, BlasMatrix<MultiModDouble> > {
+	public:
+		BlasMatrix<MultiModDouble>& operator() (const MultiModDouble &F,
+							 BlasMatrix<MultiModDouble> &C,
+							 const BlasMatrix<MultiModDouble> &A,
+							 const BlasMatrix<MultiModDouble> &B) const
+		{
+			linbox_check( A.rowdim() == B.rowdim() && A.coldim() == B.coldim());
+			linbox_check( C.rowdim() == A.rowdim() && C.coldim() == A.coldim());
+			F.addBatch(C.getWritePointer(), A.getPointer(), B.getPointer(),
+				   C.planeStride(), C.planeStride());
+			return C;
+		}
+	};
+
+	//! C = A-B over all the moduli
+	template<>
+	class BlasMatrixDomainSub<MultiModDouble, BlasMatrix<MultiModDouble>, BlasMatrix<MultiModDouble>, BlasMatrix<MultiModDouble> > {
+	public:
+		BlasMatrix<MultiModDouble>& operator() (const MultiModDouble &F,
+							 BlasMatrix<MultiModDouble> &C,
+							 const BlasMatrix<MultiModDouble> &A,
+							 const BlasMatrix<MultiModDouble> &B) const
+		{
+			linbox_check( A.rowdim() == B.rowdim() && A.coldim() == B.coldim());
+			linbox_check( C.rowdim() == A.rowdim() && C.coldim() == A.coldim());
+			F.subBatch(C.getWritePointer(), A.getPointer(), B.getPointer(),
+				   C.planeStride(), C.planeStride());
+			return C;
+		}
+	};
+
+	//! C += A over all the moduli
+	template<>
+	class BlasMatrixDomainAddin<MultiModDouble, BlasMatrix<MultiModDouble>, BlasMatrix<MultiModDouble> > {
+	public:
+		BlasMatrix<MultiModDouble>& operator() (const MultiModDouble &F,
+							 BlasMatrix<MultiModDouble> &C,
+							 const BlasMatrix<MultiModDouble> &A) const
+		{
+			linbox_check( C.rowdim() == A.rowdim() && C.coldim() == A.coldim());
+			F.addBatch(C.getWritePointer(), C.getPointer(), A.getPointer(),
+				   C.planeStride(), C.planeStride());
+			return C;
+		}
+	};
+
+	//! C -= A over all the moduli
+	template<>
+	class BlasMatrixDomainSubin<MultiModDouble, BlasMatrix<MultiModDouble>, BlasMatrix<MultiModDouble> > {
+	public:
+		BlasMatrix<MultiModDouble>& operator() (const MultiModDouble &F,
+							 BlasMatrix<MultiModDouble> &C,
+							 const BlasMatrix<MultiModDouble> &A) const
+		{
+			linbox_check( C.rowdim() == A.rowdim() && C.coldim() == A.coldim());
+			F.subBatch(C.getWritePointer(), C.getPointer(), A.getPointer(),
+				   C.planeStride(), C.planeStride());
+			return C;
+		}
+	};
+
 } // LinBox
 
-#endif // __LINBOX_blas_matrix_H
+#endif // __LINBOX_blas_matrix_multimod_H
 
 // Local Variables:
 // mode: C++
@@ -0,0 +1,383 @@
+/*
+ * Copyright (C) 2026 the LinBox group
+ *
+ * ========LICENCE========
+ * This file is part of the library LinBox.
+ *
+ * LinBox is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.	 See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ */
+
+/*! @file matrix/densematrix/tiled-blas-matrix.h
+ * @ingroup densematrix
+ * A \c TiledBlasMatrix<\c _Field > is a dense matrix stored in a file, by
+ * square tiles, for matrices that do not fit in memory.
+ */
+
+#ifndef __LINBOX_matrix_densematrix_tiled_blas_matrix_H
+#define __LINBOX_matrix_densematrix_tiled_blas_matrix_H
+
+#include <linbox/linbox-config.h>
+
+#include <string>
+#include <vector>
+#include <future>
+#include <cerrno>
+#include <cstring>
+#include <cstdlib>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/types.h>
+
+#include <fflas-ffpack/fflas/fflas.h>
+
+#include "linbox/util/debug.h"
+#include "linbox/util/error.h"
+#include "linbox/matrix/dense-matrix.h"
+#include "linbox/matrix/matrixdomain/blas-matrix-domain.h"
+
+namespace LinBox
+{
+
+	/*! Dense matrix stored out of core, by tiles.
+	 * @ingroup matrix
+	 *
+	 * The matrix is cut in \f$T \times T\f$ tiles (the last ones are padded
+	 * with zeroes), each stored contiguously, row major, in a file; tile
+	 * \f$(I,J)\f$ is the \f$(I \lceil n/T \rceil + J)\f$-th. The file is read
+	 * and written with positioned I/O, so that several threads can access
+	 * different tiles at once. It is either given by the user, and kept,
+	 * or a temporary file in \c $TMPDIR, removed with the matrix.
+	 *
+	 * Algorithms work on block columns of \f$T\f$ columns, read into memory
+	 * one at a time (a "strip" of \f$mT\f$ elements). \c BlasMatrixDomain
+	 * computes the rank, the determinant and the solution of square
+	 * systems by a left-looking PLUQ decomposition, see
+	 * \c Protected::TiledPLUQ; the matrix also has the blackbox interface.
+	 *
+	 * The elements are written as they are in memory, so \c Element must be
+	 * trivially copyable (e.g. \c Givaro::Modular<double>).
+	 */
+	template<class _Field>
+	class TiledBlasMatrix {
+	public:
+		typedef _Field                         Field;
+		typedef typename Field::Element        Element;
+		typedef TiledBlasMatrix<_Field>        Self_t;
+
+		//! default tile size
+		static const size_t DefaultTileSize = 512;
+
+		/** Constructor, the matrix is zero.
+		 * @param F field
+		 * @param m row dimension
+		 * @param n column dimension
+		 * @param T tile size
+		 * @param filename file holding the matrix, a temporary file if empty
+		 */
+		TiledBlasMatrix(const Field & F, size_t m, size_t n,
+				size_t T = DefaultTileSize, const std::string & filename = "") :
+			_field(&F), _row(m), _col(n), _tile(T), _fd(-1)
+		{
+			linbox_check(T > 0);
+			_open(filename);
+		}
+
+		//! Copy of \p A, in a temporary file
+		TiledBlasMatrix(const TiledBlasMatrix & A) :
+			_field(A._field), _row(A._row), _col(A._col), _tile(A._tile), _fd(-1)
+		{
+			_open("");
+			std::vector<Element> buf(_tile*_tile);
+			for (size_t I = 0 ; I < tileRowdim() ; ++I)
+				for (size_t J = 0 ; J < tileColdim() ; ++J) {
+					A._read(&buf[0], buf.size(), _offset(I,J));
+					_write(&buf[0], buf.size(), _offset(I,J));
+				}
+		}
+
+		//! Copy of the dense matrix \p A, in a temporary file
+		template<class Matrix>
+		TiledBlasMatrix(const Matrix & A, size_t T = DefaultTileSize) :
+			_field(&A.field()), _row(A.rowdim()), _col(A.coldim()), _tile(T), _fd(-1)
+		{
+			_open("");
+			std::vector<Element> row(_col);
+			for (size_t i = 0 ; i < _row ; ++i) {
+				for (size_t j = 0 ; j < _col ; ++j)
+					row[j] = A.getEntry(i,j);
+				writeRows(i, i+1, &row[0], _col);
+			}
+		}
+
+		~TiledBlasMatrix()
+		{
+			if (_fd >= 0)
+				::close(_fd);
+			if (_temporary)
+				::unlink(_filename.c_str());
+		}
+
+		size_t rowdim() const { return _row; }
+		size_t coldim() const { return _col; }
+		const Field & field() const { return *_field; }
+
+		//! tile size \f$T\f$
+		size_t tileSize() const { return _tile; }
+		//! number of tiles in a column
+		size_t tileRowdim() const { return (_row + _tile - 1) / _tile; }
+		//! number of tiles in a row
+		size_t tileColdim() const { return (_col + _tile - 1) / _tile; }
+		//! number of columns of block column \p J
+		size_t stripWidth(size_t J) const { return std::min(_tile, _col - J*_tile); }
+
+		const std::string & filename() const { return _filename; }
+
+		Element & getEntry(Element & x, size_t i, size_t j) const
+		{
+			_read(&x, 1, _offset(i/_tile, j/_tile) + _index(i%_tile, j%_tile));
+			return x;
+		}
+
+		Element getEntry(size_t i, size_t j) const
+		{
+			Element x;
+			return getEntry(x, i, j);
+		}
+
+		void setEntry(size_t i, size_t j, const Element & a)
+		{
+			_write(&a, 1, _offset(i/_tile, j/_tile) + _index(i%_tile, j%_tile));
+		}
+
+		/** Read rows \p i0 to \p i1 of block column \p J.
+		 * Row \f$i\f$ goes to \c S[(i-i0)*lds], its \c stripWidth(J) entries.
+		 */
+		void readStrip(size_t J, size_t i0, size_t i1, Element * S, size_t lds) const
+		{
+			const size_t w = stripWidth(J);
+			for (size_t i = i0 ; i < i1 ; ) {
+				const size_t I = i/_tile, r = std::min(i1, (I+1)*_tile) - i;
+				// one read for the rows of the tile when they are contiguous
+				if (lds == _tile && w == _tile)
+					_read(S + (i-i0)*lds, r*_tile, _offset(I,J) + _index(i%_tile, 0));
+				else
+					for (size_t k = 0 ; k < r ; ++k)
+						_read(S + (i-i0+k)*lds, w, _offset(I,J) + _index(i%_tile+k, 0));
+				i += r;
+			}
+		}
+
+		//! Write rows \p i0 to \p i1 of block column \p J, see \c readStrip
+		void writeStrip(size_t J, size_t i0, size_t i1, const Element * S, size_t lds)
+		{
+			const size_t w = stripWidth(J);
+			for (size_t i = i0 ; i < i1 ; ) {
+				const size_t I = i/_tile, r = std::min(i1, (I+1)*_tile) - i;
+				if (lds == _tile && w == _tile)
+					_write(S + (i-i0)*lds, r*_tile, _offset(I,J) + _index(i%_tile, 0));
+				else
+					for (size_t k = 0 ; k < r ; ++k)
+						_write(S + (i-i0+k)*lds, w, _offset(I,J) + _index(i%_tile+k, 0));
+				i += r;
+			}
+		}
+
+		//! Write rows \p i0 to \p i1, row \f$i\f$ being \c R[(i-i0)*ldr]
+		void writeRows(size_t i0, size_t i1, const Element * R, size_t ldr)
+		{
+			for (size_t J = 0 ; J < tileColdim() ; ++J)
+				writeStrip(J, i0, i1, R + J*_tile, ldr);
+		}
+
+		/*! @name Black box interface
+		 * The block columns are read in turn, the next one while the
+		 * current one is multiplied.
+		 */
+		//@{
+		template<class Vector1, class Vector2>
+		Vector1 & apply(Vector1 & y, const Vector2 & x) const
+		{
+			const Field & F = field();
+			std::vector<Element> yy(_row, F.zero), xx(_tile);
+			StripReader R(*this);
+			if (tileColdim()) R.prefetch(0, 0, _row);
+			for (size_t J = 0 ; J < tileColdim() ; ++J) {
+				const Element * S = R.get();
+				if (J+1 < tileColdim()) R.prefetch(J+1, 0, _row);
+				const size_t w = stripWidth(J);
+				for (size_t j = 0 ; j < w ; ++j)
+					xx[j] = x[J*_tile+j];
+				FFLAS::fgemv(F, FFLAS::FflasNoTrans, _row, w, F.one, S, _tile,
+					     &xx[0], 1, F.one, &yy[0], 1);
+			}
+			for (size_t i = 0 ; i < _row ; ++i)
+				y[i] = yy[i];
+			return y;
+		}
+
+		template<class Vector1, class Vector2>
+		Vector1 & applyTranspose(Vector1 & y, const Vector2 & x) const
+		{
+			const Field & F = field();
+			std::vector<Element> xx(_row), yy(_tile);
+			for (size_t i = 0 ; i < _row ; ++i)
+				xx[i] = x[i];
+			StripReader R(*this);
+			if (tileColdim()) R.prefetch(0, 0, _row);
+			for (size_t J = 0 ; J < tileColdim() ; ++J) {
+				const Element * S = R.get();
+				if (J+1 < tileColdim()) R.prefetch(J+1, 0, _row);
+				const size_t w = stripWidth(J);
+				FFLAS::fgemv(F, FFLAS::FflasTrans, _row, w, F.one, S, _tile,
+					     &xx[0], 1, F.zero, &yy[0], 1);
+				for (size_t j = 0 ; j < w ; ++j)
+					y[J*_tile+j] = yy[j];
+			}
+			return y;
+		}
+		//@}
+
+		/*! Double buffered reads of strips.
+		 * \c prefetch starts reading a strip in another thread, \c get
+		 * waits for it and returns it; the strip returned by the previous
+		 * \c get may be overwritten by the next \c prefetch.
+		 */
+		class StripReader {
+		public:
+			StripReader(const TiledBlasMatrix & A) :
+				_A(A), _cur(0)
+			{
+				_buf[0].resize(A.rowdim()*A.tileSize());
+				_buf[1].resize(A.rowdim()*A.tileSize());
+			}
+
+			~StripReader()
+			{
+				if (_next.valid()) _next.wait();
+			}
+
+			//! rows \p i0 to \p i1 of block column \p J, with stride \c tileSize()
+			void prefetch(size_t J, size_t i0, size_t i1)
+			{
+				Element * S = &_buf[1-_cur][0];
+				const TiledBlasMatrix & A = _A;
+				_next = std::async(std::launch::async,
+						   [&A, J, i0, i1, S]() { A.readStrip(J, i0, i1, S, A.tileSize()); });
+			}
+
+			const Element * get()
+			{
+				_next.get();
+				_cur = 1-_cur;
+				return &_buf[_cur][0];
+			}
+
+		private:
+			const TiledBlasMatrix &  _A;
+			std::vector<Element>     _buf[2];
+			int                      _cur;
+			std::future<void>        _next;
+		};
+
+	private:
+		static_assert(std::is_trivially_copyable<Element>::value,
+			      "TiledBlasMatrix elements are written to disk as they are");
+
+		const Field * _field;
+		size_t        _row, _col, _tile;
+		int           _fd;
+		std::string   _filename;
+		bool          _temporary;
+
+		TiledBlasMatrix & operator=(const TiledBlasMatrix &); // not implemented
+
+		off_t _offset(size_t I, size_t J) const
+		{
+			return (off_t)((I*tileColdim() + J)*_tile*_tile*sizeof(Element));
+		}
+
+		off_t _index(size_t i, size_t j) const
+		{
+			return (off_t)((i*_tile + j)*sizeof(Element));
+		}
+
+		void _open(const std::string & filename)
+		{
+			_temporary = filename.empty();
+			if (_temporary) {
+				const char * dir = std::getenv("TMPDIR");
+				_filename = std::string(dir ? dir : "/tmp") + "/linbox-tiled-XXXXXX";
+				std::vector<char> name(_filename.begin(), _filename.end());
+				name.push_back('\0');
+				_fd = ::mkstemp(&name[0]);
+				_filename = &name[0];
+			}
+			else {
+				_filename = filename;
+				_fd = ::open(_filename.c_str(), O_RDWR | O_CREAT, 0644);
+			}
+			if (_fd < 0)
+				throw LinboxError(("TiledBlasMatrix: cannot open " + _filename + ": " + std::strerror(errno)).c_str());
+			// zeroes, unless the file already holds a matrix of this size
+			const off_t size = _offset(tileRowdim(), 0);
+			if (::lseek(_fd, 0, SEEK_END) < size && ::ftruncate(_fd, size) != 0)
+				throw LinboxError(("TiledBlasMatrix: cannot resize " + _filename + ": " + std::strerror(errno)).c_str());
+		}
+
+		void _read(Element * x, size_t n, off_t pos) const
+		{
+			char * p = reinterpret_cast<char*>(x);
+			size_t len = n*sizeof(Element);
+			while (len) {
+				ssize_t r = ::pread(_fd, p, len, pos);
+				if (r <= 0) {
+					if (r < 0 && errno == EINTR) continue;
+					throw LinboxError(("TiledBlasMatrix: read error on " + _filename).c_str());
+				}
+				p += r; pos += r; len -= (size_t)r;
+			}
+		}
+
+		void _write(const Element * x, size_t n, off_t pos)
+		{
+			const char * p = reinterpret_cast<const char*>(x);
+			size_t len = n*sizeof(Element);
+			while (len) {
+				ssize_t r = ::pwrite(_fd, p, len, pos);
+				if (r <= 0) {
+					if (r < 0 && errno == EINTR) continue;
+					throw LinboxError(("TiledBlasMatrix: write error on " + _filename).c_str());
+				}
+				p += r; pos += r; len -= (size_t)r;
+			}
+		}
+	};
+
+} // LinBox
+
+#include "linbox/matrix/matrixdomain/blas-matrix-domain-tiled.inl"
+
+#endif // __LINBOX_matrix_densematrix_tiled_blas_matrix_H
+
+// Local Variables:
+// mode: C++
+// tab-width: 4
+// indent-tabs-mode: nil
+// c-basic-offset: 4
+// End:
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
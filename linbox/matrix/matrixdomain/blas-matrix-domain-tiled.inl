@@ -0,0 +1,256 @@
+/*
+ * Copyright (C) 2026 the LinBox group
+ *
+ * ========LICENCE========
+ * This file is part of the library LinBox.
+ *
+ * LinBox is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.	 See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ */
+
+/*! @file matrix/matrixdomain/blas-matrix-domain-tiled.inl
+ * @ingroup matrixdomain
+ * @brief Rank, determinant and system solving for TiledBlasMatrix.
+ */
+
+#ifndef __LINBOX_matrix_matrixdomain_blas_matrix_domain_tiled_INL
+#define __LINBOX_matrix_matrixdomain_blas_matrix_domain_tiled_INL
+
+#include <fflas-ffpack/ffpack/ffpack.h>
+#include <fflas-ffpack/fflas/fflas.h>
+
+namespace LinBox { namespace Protected {
+
+	/*! @internal Left-looking PLUQ decomposition of a TiledBlasMatrix.
+	 *
+	 * The block columns (strips) are factored in turn. Strip \f$J\f$ is
+	 * read, then updated by the factors of each strip \f$K < J\f$: its
+	 * rows are permuted by \f$P_K\f$ as those of \f$K\f$, the \f$r_K\f$
+	 * pivot rows solved by \f$L_K\f$'s unit triangle, and the rows below updated by a
+	 * product by the rest of \f$L_K\f$. Its remaining rows are then
+	 * factored in memory by \c FFPACK::PLUQ, with rank \f$r_J\f$, and the
+	 * strip is written back. The factors of strip \f$K+1\f$ are read by
+	 * another thread while strip \f$K\f$ is used, so that at most three
+	 * strips (\f$3mT\f$ elements) are in memory.
+	 *
+	 * The rank is the sum of the \f$r_J\f$; a square matrix is
+	 * nonsingular iff every strip has full rank, and then the determinant
+	 * is the product of the diagonals of the \f$U_J\f$ and of the signs
+	 * of the \f$P_J\f$ and \f$Q_J\f$. The matrix is overwritten by its
+	 * factors.
+	 */
+	template<class Field>
+	class TiledPLUQ {
+	public:
+		typedef typename Field::Element        Element;
+		typedef TiledBlasMatrix<Field>         Matrix;
+		typedef typename Matrix::StripReader   StripReader;
+
+		/** Factor \p A.
+		 * @param stopIfSingular stop at the first strip of deficient
+		 * rank, when only nonsingularity matters.
+		 */
+		TiledPLUQ(const Field & F, Matrix & A, bool stopIfSingular = false) :
+			_F(F), _A(A), _rank(0), _complete(true)
+		{
+			const size_t m = A.rowdim(), T = A.tileSize();
+			std::vector<Element> S(m*T);
+			for (size_t J = 0 ; J < A.tileColdim() && _rank < m ; ++J) {
+				const size_t w = A.stripWidth(J);
+				A.readStrip(J, 0, m, &S[0], T);
+				_update(&S[0], T, w, J);
+
+				_offset.push_back(_rank);
+				_P.push_back(std::vector<size_t>(m-_rank));
+				_Q.push_back(std::vector<size_t>(w));
+				const size_t r = FFPACK::PLUQ(F, FFLAS::FflasNonUnit, m-_rank, w,
+							      &S[_rank*T], T, &_P.back()[0], &_Q.back()[0]);
+				_r.push_back(r);
+				A.writeStrip(J, 0, m, &S[0], T); // with the U_KJ above
+				_rank += r;
+				if (stopIfSingular && r < w) {
+					_complete = (J+1 == A.tileColdim());
+					break;
+				}
+			}
+		}
+
+		size_t rank() const
+		{
+			linbox_check(_complete);
+			return _rank;
+		}
+
+		//! nonsingularity of a square matrix
+		bool nonsingular() const
+		{
+			return _A.rowdim() == _A.coldim() && _rank == _A.rowdim();
+		}
+
+		Element & det(Element & d) const
+		{
+			if (!nonsingular())
+				return _F.assign(d, _F.zero);
+			const size_t T = _A.tileSize();
+			std::vector<Element> S(T*T);
+			bool odd = false;
+			_F.assign(d, _F.one);
+			for (size_t J = 0 ; J < _r.size() ; ++J) {
+				const size_t w = _r[J];
+				_A.readStrip(J, _offset[J], _offset[J]+w, &S[0], T);
+				for (size_t i = 0 ; i < w ; ++i)
+					_F.mulin(d, S[i*T+i]);
+				for (size_t i = 0 ; i < _P[J].size() ; ++i)
+					if (_P[J][i] != i) odd = !odd;
+				for (size_t i = 0 ; i < w ; ++i)
+					if (_Q[J][i] != i) odd = !odd;
+			}
+			if (odd) _F.negin(d);
+			return d;
+		}
+
+		/** \f$x = A^{-1}b\f$, for a nonsingular \f$A\f$.
+		 * \f$b\f$ is updated as a strip of width 1, then the \f$U_J\f$
+		 * are applied backwards, one strip at a time.
+		 */
+		template<class Vector1, class Vector2>
+		Vector1 & solve(Vector1 & x, const Vector2 & b) const
+		{
+			if (!nonsingular())
+				throw LinboxMathInconsistentSystem("TiledBlasMatrix: the system is singular");
+			const size_t n = _A.rowdim(), T = _A.tileSize(), nt = _r.size();
+			std::vector<Element> y(n);
+			for (size_t i = 0 ; i < n ; ++i)
+				y[i] = b[i];
+			_update(&y[0], 1, 1, nt);
+
+			// y_J <- U_JJ^-1 y_J, x_J = Q_J^T y_J, then the rows above
+			StripReader R(_A);
+			R.prefetch(nt-1, 0, n);
+			for (size_t J = nt ; J-- > 0 ; ) {
+				const Element * S = R.get();
+				if (J) R.prefetch(J-1, 0, _offset[J-1]+_r[J-1]);
+				const size_t o = _offset[J], w = _r[J];
+				FFLAS::ftrsv(_F, FFLAS::FflasUpper, FFLAS::FflasNoTrans, FFLAS::FflasNonUnit,
+					     w, S + o*T, T, &y[o], 1);
+				FFPACK::applyP(_F, FFLAS::FflasLeft, FFLAS::FflasTrans, 1, 0, w, &y[o], 1, &_Q[J][0]);
+				if (o)
+					FFLAS::fgemv(_F, FFLAS::FflasNoTrans, o, w, _F.mOne, S, T,
+						     &y[o], 1, _F.one, &y[0], 1);
+			}
+			for (size_t i = 0 ; i < n ; ++i)
+				x[i] = y[i];
+			return x;
+		}
+
+	private:
+		const Field &                       _F;
+		Matrix &                            _A;
+		size_t                              _rank;
+		bool                                _complete;
+		std::vector<size_t>                 _offset; //!< first row of the pivots of each strip
+		std::vector<size_t>                 _r;      //!< rank of each strip
+		std::vector<std::vector<size_t> >   _P, _Q;
+
+		// Apply the factors of the strips K < J to the m x w strip S
+		void _update(Element * S, size_t lds, size_t w, size_t J) const
+		{
+			const size_t m = _A.rowdim(), T = _A.tileSize();
+			if (!J) return;
+			StripReader R(_A);
+			R.prefetch(0, _offset[0], m);
+			for (size_t K = 0 ; K < J ; ++K) {
+				const Element * L = R.get(); // rows o_K.. of strip K
+				if (K+1 < J) R.prefetch(K+1, _offset[K+1], m);
+				const size_t o = _offset[K], r = _r[K];
+				Element * SK = S + o*lds;
+				FFPACK::applyP(_F, FFLAS::FflasLeft, FFLAS::FflasNoTrans, w, 0, m-o, SK, lds, &_P[K][0]);
+				if (!r) continue;
+				FFLAS::ftrsm(_F, FFLAS::FflasLeft, FFLAS::FflasLower, FFLAS::FflasNoTrans, FFLAS::FflasUnit,
+					     r, w, _F.one, L, T, SK, lds);
+				if (o + r < m)
+					FFLAS::fgemm(_F, FFLAS::FflasNoTrans, FFLAS::FflasNoTrans, m-o-r, w, r,
+						     _F.mOne, L + r*T, T, SK, lds, _F.one, SK + r*lds, lds);
+			}
+		}
+	};
+
+} // Protected
+} // LinBox
+
+namespace LinBox
+{
+
+	template<class Field>
+	class BlasMatrixDomainRank<Field, TiledBlasMatrix<Field> > {
+	public:
+		unsigned int operator() (const Field &F, const TiledBlasMatrix<Field> & A) const
+		{
+			TiledBlasMatrix<Field> B(A);
+			return (*this)(F, B);
+		}
+
+		unsigned int operator() (const Field &F, TiledBlasMatrix<Field> & A) const
+		{
+			return (unsigned int) Protected::TiledPLUQ<Field>(F, A).rank();
+		}
+	};
+
+	template<class Field>
+	class BlasMatrixDomainDet<Field, TiledBlasMatrix<Field> > {
+	public:
+		typename Field::Element operator() (const Field &F, const TiledBlasMatrix<Field> & A) const
+		{
+			TiledBlasMatrix<Field> B(A);
+			return (*this)(F, B);
+		}
+
+		typename Field::Element operator() (const Field &F, TiledBlasMatrix<Field> & A) const
+		{
+			typename Field::Element d;
+			if (A.rowdim() != A.coldim())
+				return F.assign(d, F.zero);
+			return Protected::TiledPLUQ<Field>(F, A, true).det(d);
+		}
+	};
+
+	//! \p Operand is a vector here
+	template<class Field, class Operand>
+	class BlasMatrixDomainLeftSolve<Field, Operand, TiledBlasMatrix<Field>, Operand> {
+	public:
+		Operand & operator() (const Field &F, Operand &X, const TiledBlasMatrix<Field> &A, const Operand &B) const
+		{
+			TiledBlasMatrix<Field> C(A);
+			return Protected::TiledPLUQ<Field>(F, C, true).solve(X, B);
+		}
+
+		Operand & operator() (const Field &F, const TiledBlasMatrix<Field> &A, Operand &B) const
+		{
+			TiledBlasMatrix<Field> C(A);
+			return Protected::TiledPLUQ<Field>(F, C, true).solve(B, B);
+		}
+	};
+
+} // LinBox
+
+#endif // __LINBOX_matrix_matrixdomain_blas_matrix_domain_tiled_INL
+
+// Local Variables:
+// mode: C++
+// tab-width: 4
+// indent-tabs-mode: nil
+// c-basic-offset: 4
+// End:
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
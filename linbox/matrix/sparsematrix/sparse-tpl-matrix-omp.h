@@ -33,7 +33,6 @@
 
 #include <algorithm>
 #include <iostream>
-#include <map>
 #include "linbox/linbox-config.h"
 #include "linbox/util/debug.h"
 #include "linbox/util/field-axpy.h"
@@ -47,13 +46,6 @@
 namespace LinBox
 {
 
-union TriplesSmallCoord {
-	uint8_t c[8];
-	uint16_t s[4];
-	uint32_t i[2];
-	uint64_t l;
-};
-
 template <class Element>
 struct TriplesBBTriple {
 	TriplesBBTriple(TriplesCoord c):coord_(c) {}
@@ -76,157 +68,35 @@ struct TriplesBBTriple {
 					const TriplesBBTriple<Element>& rhs) {
 		return lhs.coord_<rhs.coord_;
 	}
+	static bool compareRowCol(const TriplesBBTriple<Element>& lhs,
+				  const TriplesBBTriple<Element>& rhs) {
+		return (lhs.getRow()<rhs.getRow()) ||
+			((lhs.getRow()==rhs.getRow()) && (lhs.getCol()<rhs.getCol()));
+	}
 	TriplesCoord coord_;
 	Element elt_;
 };
 
-struct TriplesBlock {
-	Index start_,end_;
-	TriplesCoord blockStart_, blockEnd_;
-
-	TriplesBlock(Index start,Index end,TriplesCoord blockStart,TriplesCoord blockEnd) :
-		start_(start),end_(end),
-		blockStart_(blockStart),blockEnd_(blockEnd) {
-	}
-	Index nnz() const {return end_-start_;}
-	TriplesCoord blockSize() const {return blockEnd_-blockStart_;}
-	void toBlock() {
-		coordToBlock(blockStart_);
-		coordToBlock(blockEnd_);
-	}
-	void fromBlock() {
-		coordFromBlock(blockStart_);
-		coordFromBlock(blockEnd_);
-
-	}
-	inline const Index& getStartRow() const {
-		return blockStart_.rowCol[0];
-	}
-	inline const Index& getStartCol() const {
-		return blockStart_.rowCol[1];
-	}
-	inline const Index& getEndRow() const {
-		return blockEnd_.rowCol[0];
-	}
-	inline const Index& getEndCol() const {
-		return blockEnd_.rowCol[1];
-	}
-	static bool compareBlockSizes(const TriplesBlock& lhs,
-				      const TriplesBlock& rhs) {
-		return lhs.blockSize()<rhs.blockSize();
-	}
-};
-
-
+/* One tile of the 2D tiling of a TPL_omp matrix: the entries in a row
+ * band and a column band, in row major order. Coordinates are stored as
+ * 32 bits offsets from the start of the bands.
+ */
 template <class Element>
-struct TriplesDataBlock {
-	TriplesCoord blockStart_, blockEnd_, blockSize_;
-	std::vector<TriplesSmallCoord> rowIxs_,colIxs_;
+struct TriplesTile {
+	Index rowStart_, colStart_;
+	std::vector<uint32_t> rowOffs_, colOffs_;
 	std::vector<Element> elts_;
-	int ccf_;
 
-	typedef TriplesBBTriple<Element> Triple;
-	typedef typename std::vector<Triple> TripleList;
-	typedef typename TripleList::const_iterator TripleListIt;
-
-        inline Index getRow(int ix) const {
-                Index retVal=getStartRow();
-                const TriplesSmallCoord *rowIxPtr=&(rowIxs_[ix>>ccf_]);
-                switch (ccf_) {
-                case 0:
-                        return rowIxPtr->l;
-                case 1:
-                        return (retVal|(rowIxPtr->i[ix&1]));
-                case 2:
-                        return (retVal|(rowIxPtr->s[ix&3]));
-                case 3:
-                default:
-                        return (retVal|(rowIxPtr->c[ix&7]));
-                }
-        }
-        inline Index getCol(int ix) const {
-                Index retVal=getStartCol();
-                const TriplesSmallCoord *colIxPtr=&(colIxs_[ix>>ccf_]);
-                switch (ccf_) {
-                case 0:
-                        return colIxPtr->l;
-                case 1:
-                        return (retVal|(colIxPtr->i[ix&1]));
-                case 2:
-                        return (retVal|(colIxPtr->s[ix&3]));
-                case 3:
-                default:
-                        return (retVal|(colIxPtr->c[ix&7]));
-                }
-        }
+	TriplesTile() : rowStart_(0), colStart_(0) {}
 
-	void init(TriplesCoord blockStart,
-		  TriplesCoord blockEnd,
-		  TriplesCoord myBlockSize, // blockSize shadows blockSize()
-		  TripleListIt triplesStart,
-		  TripleListIt triplesEnd,
-		  int ccf) {
-		blockStart_=blockStart;
-		blockEnd_=blockEnd;
-		blockSize_=myBlockSize;
-		ccf_=ccf;
-                int numElts=(int)(triplesEnd-triplesStart);
-		rowIxs_.resize(1+(numElts>>ccf));
-		colIxs_.resize(1+(numElts>>ccf));
-		elts_.reserve(numElts);
-
-		int coordOffset=0, coordIx=0;
-		while (triplesStart != triplesEnd) {
-			elts_.push_back(triplesStart->getElt());
-
-			switch (ccf) {
-			case 0:
-				rowIxs_[coordIx].l=(uint64_t)(triplesStart->getRow());
-				colIxs_[coordIx].l=(uint64_t)(triplesStart->getCol());
-				break;
-			case 1:
-				rowIxs_[coordIx].i[coordOffset]=
-					(uint32_t)(triplesStart->getRow());
-				colIxs_[coordIx].i[coordOffset]=
-					(uint32_t)(triplesStart->getCol());
-				break;
-			case 2:
-				rowIxs_[coordIx].s[coordOffset]=
-					(uint16_t)(triplesStart->getRow());
-				colIxs_[coordIx].s[coordOffset]=
-					(uint16_t)(triplesStart->getCol());
-				break;
-			case 3:
-				rowIxs_[coordIx].c[coordOffset]=
-					(uint8_t)(triplesStart->getRow());
-				colIxs_[coordIx].c[coordOffset]=
-					(uint8_t)(triplesStart->getCol());
-				break;
-			}
-
-			++coordOffset;
-			if (coordOffset==(1<<ccf)) {
-				coordOffset=0;
-				++coordIx;
-			}
-			++triplesStart;
-		}
-	}
+	inline size_t nnz() const {return elts_.size();}
+	inline Index getRow(size_t k) const {return rowStart_+rowOffs_[k];}
+	inline Index getCol(size_t k) const {return colStart_+colOffs_[k];}
 
-	inline TriplesCoord blockSize() const {
-		return blockSize_;
-	}
-	inline Index getStartRow() const {
-		return blockStart_.rowCol[0];
-	}
-	inline Index getStartCol() const {
-		return blockStart_.rowCol[1];
-	}
-	inline Index getEndRow() const {
-		return blockEnd_.rowCol[0];
-	}
-	inline Index getEndCol() const {
-		return blockEnd_.rowCol[1];
+	void push_back(Index row, Index col, const Element& e) {
+		rowOffs_.push_back((uint32_t)(row-rowStart_));
+		colOffs_.push_back((uint32_t)(col-colStart_));
+		elts_.push_back(e);
 	}
 };
 
@@ -235,6 +105,14 @@ struct TriplesDataBlock {
  *
  \ingroup blackbox
  * Sparse matrix representation which stores nonzero entries by i,j,value triples.
+ *
+ * finalize() cuts the rows, and the columns, into one band per thread
+ * with about the same number of nonzero entries, and stores the entries
+ * of each (row band, column band) tile together. apply() and applyLeft()
+ * give each thread a row band, applyTranspose() and applyRight() a column
+ * band: no two threads ever write to the same part of the output. The
+ * tiles of a row band are allocated (first touched) by the thread which
+ * applies them, as are the accumulators of the output.
  */
 template<class Field_>
 class SparseMatrix<Field_, SparseMatrixFormat::TPL_omp> : public BlackboxInterface {
@@ -325,59 +203,27 @@ class SparseMatrix<Field_, SparseMatrixFormat::TPL_omp> : public BlackboxInterfa
 	};
 
         //For debugging:
-        typename std::vector<std::vector<std::vector<TriplesDataBlock<Element> > > >& getRowBlocks() {
-                return rowBlocks_;
+        const std::vector<TriplesTile<Element> >& getTiles() const {
+                return tiles_;
         }
 
-protected:
-
-	const static Index MAX_BLOCK_NNZ=1024;
-        const static size_t CACHE_ALIGNMENT=64;
-
-        inline static int roundUpIndex(Index val) {
-                int exponent=0;
-                --val;
-                while (val > 0) {
-                        ++exponent;
-                        val=val>>1;
-                }
-                return 1<<exponent;
+        // the (row, col, value) triples, without repetition once finalized
+        const std::vector<TriplesBBTriple<Element> >& refDataConst() const {
+                return data_;
         }
 
-	typedef TriplesBBTriple<Element> Triple;
-	typedef TriplesDataBlock<Element> DataBlock;
-
-        typedef std::vector<TriplesBlock> RefBlockList;
-
-        typedef std::vector<DataBlock> BlockList;
-        typedef typename BlockList::iterator BlockListIt;
-        typedef std::vector<BlockList> VectorChunks;
-        typedef typename VectorChunks::iterator VectorChunkIt;
-        typedef std::vector<VectorChunks> SizedChunks;
-
-	typedef std::map<Index,Index> IntervalSet;
-	typedef typename IntervalSet::iterator IntervalIterator;
-	typedef std::pair<Index,Index> Interval;
-
-	void splitBlock(RefBlockList &superBlocks, TriplesBlock block);
-
-	void toDataBlock(const RefBlockList& superBlocks,
-			 BlockList& dataBlocks);
+protected:
 
-	void computeVectors(SizedChunks &sizedChunks,
-			    BlockList &superBlocks,
-			    const int rowOrCol);
+	typedef TriplesBBTriple<Element> Triple;
+	typedef TriplesTile<Element> Tile;
 
-        void combineIntervals(BlockListIt startIt,
-                              BlockListIt endIt,
-                              IntervalSet& intervals,
-                              VectorChunks& chunksOut,
-                              const int rowOrCol);
+	// bounds of at most numBands bands with about the same total of counts
+	static void balancedBounds(std::vector<Index>& bounds,
+				   const std::vector<size_t>& counts,
+				   Index numBands);
 
-        void nonOverlappingIntervals(BlockListIt startIt,
-                                     BlockListIt endIt,
-                                     IntervalSet& intervals,
-                                     const int rowOrCol);
+	inline Index numRowBands() const {return rowBounds_.empty()?0:rowBounds_.size()-1;}
+	inline Index numColBands() const {return colBounds_.empty()?0:colBounds_.size()-1;}
 
 	MatrixDomain<Field> MD_;
 
@@ -391,12 +237,11 @@ protected:
 	//Either TRIPLES_SORTED or TRIPLES_UNSORTED
 	int sortType_;
 
-#define CHUNK_BY_ROW 1
-#define CHUNK_BY_COL 2
-
-        SizedChunks rowBlocks_;
+	// row band i is [rowBounds_[i],rowBounds_[i+1]), same for columns
+	std::vector<Index> rowBounds_, colBounds_;
 
-        SizedChunks colBlocks_;
+	// tile (i,j) is tiles_[i*numColBands()+j]
+	std::vector<Tile> tiles_;
   }; // SparseMatrix
 
 } // namespace LinBox
@@ -46,118 +46,27 @@ namespace LinBox
 {
 
 template<class Field_>
-void SparseMatrix<Field_,SparseMatrixFormat::TPL_omp>::nonOverlappingIntervals(BlockListIt startIt,
-                                              BlockListIt endIt,
-                                              IntervalSet& intervals,
-                                              const int rowOrCol)
+void SparseMatrix<Field_,SparseMatrixFormat::TPL_omp>::balancedBounds(std::vector<Index>& bounds,
+                                                                     const std::vector<size_t>& counts,
+                                                                     Index numBands)
 {
-        for (;startIt!=endIt;++startIt) {
-                Index start,end;
-                if (rowOrCol==CHUNK_BY_ROW) {
-                        start=(*startIt).getStartRow();
-                        end=(*startIt).getEndRow();
-                } else {
-                        start=(*startIt).getStartCol();
-                        end=(*startIt).getEndCol();
-                }
-
-		//invariant: no existing interval is dominated by any other
-
-		//if the new interval is not dominated by any other, insert it
-		IntervalIterator it=intervals.lower_bound(start);
-		bool insert=false;
-		if (it == intervals.end()) {
-			insert=true;
-		} else if (it->first == start) {
-			if (it->second < end) {
-				insert=true;
-			}
-		} else {
-			if (it != intervals.begin()) {
-				--it;
-			}
-			if (it->first > start) {
-				insert=true;
-			} else if (it->second < start) {
-				insert=true;
-			}
-		}
-		if (insert) {
-			intervals[start]=end;
-			it=intervals.upper_bound(start);
-
-			//remove all intervals dominated by the new one
-			while ((it!=intervals.end()) && (it->first <= end)) {
-				++it;
-			}
-			intervals.erase(intervals.upper_bound(start),it);
-		}
-	}
-}
-
-template<class Field_>
-void SparseMatrix<Field_,SparseMatrixFormat::TPL_omp>::combineIntervals(BlockListIt startIt,
-                                            BlockListIt endIt,
-                                            IntervalSet& intervals,
-                                            VectorChunks& chunksOut,
-                                            const int rowOrCol)
-{
-	typedef std::map<Index,BlockList> VectorBlockMap;
-
-	VectorBlockMap vectorMap;
-	for (IntervalIterator it=intervals.begin();it!=intervals.end();++it) {
-		vectorMap[it->first];
-	}
-
-        for (;startIt!=endIt;++startIt) {
-                Index start;
-                if (rowOrCol==CHUNK_BY_ROW) {
-                        start=startIt->getStartRow();
-                } else {
-                        start=startIt->getStartCol();
-                }
-
-		IntervalIterator it=intervals.lower_bound(start);
-		if (it != intervals.begin()) {
-			--it;
-		}
-		vectorMap[it->first].push_back(*startIt);
-	}
-
-        chunksOut.clear();
-        for (typename VectorBlockMap::iterator it=vectorMap.begin();
-             it!=vectorMap.end();
-             ++it) {
-                chunksOut.push_back(it->second);
+        size_t total=0, acc=0;
+        for (size_t i=0;i<counts.size();++i) {
+                total+=counts[i];
         }
-}
-
-template<class Field_>
-void SparseMatrix<Field_,SparseMatrixFormat::TPL_omp>::computeVectors(SizedChunks& sizedChunks,
-					  BlockList& superBlocks,
-					  const int rowOrCol)
-{
-	IntervalSet intervals;
-        VectorChunks chunks;
-
-        Index k=0;
-        Index numSuperBlocks=superBlocks.size();
-        while (k<numSuperBlocks) {
-                TriplesCoord blockSize=superBlocks[k].blockSize();
-                BlockListIt start=superBlocks.begin()+k;
-                while (superBlocks[k].blockSize()==blockSize) {
-                        ++k;
-                        if (k>=numSuperBlocks) {
-                                break;
-                        }
+        bounds.assign(1,0);
+        for (Index i=0;i<counts.size();++i) {
+                acc+=counts[i];
+                if ((bounds.size()<numBands) && (acc*numBands>=total*bounds.size())) {
+                        bounds.push_back(i+1);
                 }
-                BlockListIt end=superBlocks.begin()+k;
-
-                intervals.clear();
-                nonOverlappingIntervals(start,end,intervals,rowOrCol);
-                chunks.clear();
-                combineIntervals(start,end,intervals,chunks,rowOrCol);
-		sizedChunks.push_back(chunks);
+        }
+        if (bounds.back()!=counts.size()) {
+                bounds.push_back(counts.size());
+        }
+        // a band must fit the 32 bits offsets of the tiles
+        for (size_t i=1;i<bounds.size();++i) {
+                linbox_check(bounds[i]-bounds[i-1] <= (Index)UINT32_MAX+1);
         }
 }
 
@@ -195,7 +104,7 @@ std::ostream& SparseMatrix<Field_,SparseMatrixFormat::TPL_omp>::write(std::ostre
 
 template<class Field_>
 SparseMatrix<Field_,SparseMatrixFormat::TPL_omp>& SparseMatrix<Field_,SparseMatrixFormat::TPL_omp>::shape(const Field& F, Index r, Index c)
-{ MD_=F; data_.clear(); rows_ = r; cols_ = c; sortType_ = TRIPLES_UNSORTED; return *this; }
+{ MD_=F; data_.clear(); tiles_.clear(); rowBounds_.clear(); colBounds_.clear(); rows_ = r; cols_ = c; sortType_ = TRIPLES_UNSORTED; return *this; }
 
 template<class Field_> SparseMatrix<Field_,SparseMatrixFormat::TPL_omp>::
 SparseMatrix(const Field& F, Index r, Index c)
@@ -207,7 +116,7 @@ SparseMatrix<Field_,SparseMatrixFormat::TPL_omp>::SparseMatrix(const SparseMatri
         : MD_(B.MD_), data_ ( B.data_ ),
           rows_ ( B.rows_ ), cols_ ( B.cols_ ),
           sortType_ ( B.sortType_ ),
-          rowBlocks_(B.rowBlocks_),colBlocks_(B.colBlocks_)
+          rowBounds_(B.rowBounds_),colBounds_(B.colBounds_),tiles_(B.tiles_)
 {}
 
 // template<class Field_>
@@ -220,8 +129,9 @@ SparseMatrix<Field_,SparseMatrixFormat::TPL_omp>::SparseMatrix(const SparseMatri
 // 	rows_ = rhs.rows_;
 // 	cols_ = rhs.cols_;
 // 	sortType_ = rhs.sortType_;
-//         rowBlocks_=rhs.rowBlocks_;
-//         colBlocks_=rhs.colBlocks_;
+//         rowBounds_=rhs.rowBounds_;
+//         colBounds_=rhs.colBounds_;
+//         tiles_=rhs.tiles_;
 // 	return *this;
 // }
 
@@ -230,31 +140,22 @@ template<class Mat1, class Mat2> Mat1& SparseMatrix<Field_,SparseMatrixFormat::T
 applyLeft(Mat1 &Y, const Mat2 &X) const
 {
         Y.zero();
+        const long numRowBands=(long)this->numRowBands();
+        const Index numColBands=this->numColBands();
 
+        // row band i is only written by the thread applying tiles (i,*)
 #ifdef __LINBOX_USE_OPENMP
-#pragma omp parallel
-#endif
-	{
-		Index numBlockSizes=rowBlocks_.size();
-		for (Index chunkSizeIx=0;chunkSizeIx<numBlockSizes;++chunkSizeIx) {
-			const VectorChunks *rowChunks=&(rowBlocks_[chunkSizeIx]);
-			Index numChunks=rowChunks->size();
-#ifdef __LINBOX_USE_OPENMP
-#pragma omp for schedule (static,1)
+#pragma omp parallel for schedule (static,1)
 #endif
-			for (Index rowChunk=0;rowChunk<numChunks;++rowChunk) {
-				const BlockList *blocks=&((*rowChunks)[rowChunk]);
-				Index numBlocks=blocks->size();
-				for (Index block=0;block<numBlocks;++block) {
-                                        const DataBlock *dataBlock=&((*blocks)[block]);
-					for (Index k=0;k<dataBlock->elts_.size();++k) {
-                                                const Index row=dataBlock->getRow((int)k);
-                                                const Index col=dataBlock->getCol((int)k);
-                                                typename Matrix::constSubMatrixType Xr(X,col,0,1,X.coldim());
-                                                typename Matrix::subMatrixType Yr(Y,row,0,1,Y.coldim());
-                                                MD_.saxpyin(Yr,dataBlock->elts_[k],Xr);
-                                        }
-                                }
+        for (long rowBand=0;rowBand<numRowBands;++rowBand) {
+                for (Index colBand=0;colBand<numColBands;++colBand) {
+                        const Tile& tile=tiles_[(Index)rowBand*numColBands+colBand];
+                        for (size_t k=0;k<tile.nnz();++k) {
+                                const Index row=tile.getRow(k);
+                                const Index col=tile.getCol(k);
+                                typename Matrix::constSubMatrixType Xr(X,col,0,1,X.coldim());
+                                typename Matrix::subMatrixType Yr(Y,row,0,1,Y.coldim());
+                                MD_.saxpyin(Yr,tile.elts_[k],Xr);
                         }
                 }
         }
@@ -268,31 +169,22 @@ applyRight(Mat1 &Y, const Mat2 &X) const
         Y.zero();
         typedef AbnormalMatrix<Field_,Mat1> AbnormalMat;
         AbnormalMat YTemp(field(),Y);
+        const Index numRowBands=this->numRowBands();
+        const long numColBands=(long)this->numColBands();
 
+        // column band j is only written by the thread applying tiles (*,j)
 #ifdef __LINBOX_USE_OPENMP
-#pragma omp parallel
-#endif
-	{
-		Index numBlockSizes=colBlocks_.size();
-		for (Index chunkSizeIx=0;chunkSizeIx<numBlockSizes;++chunkSizeIx) {
-			const VectorChunks *colChunks=&(colBlocks_[chunkSizeIx]);
-			Index numChunks=colChunks->size();
-#ifdef __LINBOX_USE_OPENMP
-#pragma omp for schedule (static,1)
+#pragma omp parallel for schedule (static,1)
 #endif
-			for (Index colChunk=0;colChunk<numChunks;++colChunk) {
-				const BlockList *blocks=&((*colChunks)[colChunk]);
-				Index numBlocks=blocks->size();
-				for (Index block=0;block<numBlocks;++block) {
-                                        const DataBlock *dataBlock=&((*blocks)[block]);
-					for (Index k=0;k<dataBlock->elts_.size();++k) {
-                                                const Index row=dataBlock->getRow((int)k);
-                                                const Index col=dataBlock->getCol((int)k);
-                                                typename Matrix::constSubMatrixType Xc(X,0,row,X.rowdim(),1);
-                                                YTemp.saxpyin(dataBlock->elts_[k],Xc,
-                                                              0,col,Y.rowdim(),1);
-                                        }
-                                }
+        for (long colBand=0;colBand<numColBands;++colBand) {
+                for (Index rowBand=0;rowBand<numRowBands;++rowBand) {
+                        const Tile& tile=tiles_[rowBand*(Index)numColBands+(Index)colBand];
+                        for (size_t k=0;k<tile.nnz();++k) {
+                                const Index row=tile.getRow(k);
+                                const Index col=tile.getCol(k);
+                                typename Matrix::constSubMatrixType Xc(X,0,row,X.rowdim(),1);
+                                YTemp.saxpyin(tile.elts_[k],Xc,
+                                              0,col,Y.rowdim(),1);
                         }
                 }
         }
@@ -307,54 +199,30 @@ OutVector & SparseMatrix<Field_,SparseMatrixFormat::TPL_omp>::apply(OutVector &
 	linbox_check( coldim() == x.size() );
 	linbox_check( rowdim() == y.size() );
 
-	uint8_t* yTempSpace=new uint8_t[sizeof(Field_)*y.size()+CACHE_ALIGNMENT];
-	size_t spacePtr=(size_t)yTempSpace;
-	FieldAXPY<Field_>* yTemp=(FieldAXPY<Field_>*)(spacePtr+CACHE_ALIGNMENT-(spacePtr%CACHE_ALIGNMENT));
+        const long numRowBands=(long)this->numRowBands();
+        const Index numColBands=this->numColBands();
 
-
-#ifdef __LINBOX_USE_OPENMP
-#pragma omp parallel
-#endif
-	{
-                const Field_& fieldRef=field();
 #ifdef __LINBOX_USE_OPENMP
-#pragma omp for schedule (static,1024)
+#pragma omp parallel for schedule (static,1)
 #endif
-                for (size_t i=0;i<y.size();++i) {
-                        new ((void*)(yTemp+i)) FieldAXPY<Field_>(fieldRef);
+        for (long rowBand=0;rowBand<numRowBands;++rowBand) {
+                const Index rowStart=rowBounds_[(size_t)rowBand];
+                const Index rowEnd=rowBounds_[(size_t)rowBand+1];
+                // allocated, hence first touched, by the thread owning the band
+                std::vector<FieldAXPY<Field_> > yTemp(rowEnd-rowStart,FieldAXPY<Field_>(field()));
+                for (Index colBand=0;colBand<numColBands;++colBand) {
+                        const Tile& tile=tiles_[(Index)rowBand*numColBands+colBand];
+                        for (size_t k=0;k<tile.nnz();++k) {
+                                yTemp[tile.rowOffs_[k]].mulacc(tile.elts_[k],x[tile.getCol(k)]);
+                        }
                 }
-
-		Index numBlockSizes=rowBlocks_.size();
-		for (Index chunkSizeIx=0;chunkSizeIx<numBlockSizes;++chunkSizeIx) {
-			const VectorChunks *rowChunks=&(rowBlocks_[chunkSizeIx]);
-			Index numChunks=rowChunks->size();
-#ifdef __LINBOX_USE_OPENMP
-#pragma omp for schedule (static,1)
-#endif
-			for (Index rowChunk=0;rowChunk<numChunks;++rowChunk) {
-				const BlockList *blocks=&((*rowChunks)[rowChunk]);
-				Index numBlocks=blocks->size();
-				for (Index block=0;block<numBlocks;++block) {
-                                        const DataBlock *dataBlock=&((*blocks)[block]);
-					for (Index k=0;k<dataBlock->elts_.size();++k) {
-                                                const Index row=dataBlock->getRow((int)k);
-                                                const Index col=dataBlock->getCol((int)k);
-                                                yTemp[row].mulacc(dataBlock->elts_[k],x[col]);
-					}
-				}
-			}
-			//implicit barrier
-		}
-#ifdef __LINBOX_USE_OPENMP
-#pragma omp for schedule (static,1024)
-#endif
-		for (Index i = 0; i < y.size(); ++i) {
-			yTemp[i].get(y[i]);
-			yTemp[i].~FieldAXPY<Field_>();
-		}
-	}
-
-	delete[] yTempSpace;
+                for (Index i=rowStart;i<rowEnd;++i) {
+                        yTemp[i-rowStart].get(y[i]);
+                }
+        }
+        // rows outside the bands: all of them before finalize()
+        for (Index i=(rowBounds_.empty() ? 0 : rowBounds_.back());i<y.size();++i)
+                field().assign(y[i],field().zero);
         return y;
 }
 
@@ -365,54 +233,28 @@ OutVector & SparseMatrix<Field_,SparseMatrixFormat::TPL_omp>::applyTranspose(Out
 	linbox_check( coldim() == y.size() );
 	linbox_check( rowdim() == x.size() );
 
-	uint8_t* yTempSpace=new uint8_t[sizeof(Field_)*y.size()+CACHE_ALIGNMENT];
-	size_t spacePtr=(size_t)yTempSpace;
-	FieldAXPY<Field_>* yTemp=(FieldAXPY<Field_>*)(spacePtr+CACHE_ALIGNMENT-(spacePtr%CACHE_ALIGNMENT));
-
+        const Index numRowBands=this->numRowBands();
+        const long numColBands=(long)this->numColBands();
 
 #ifdef __LINBOX_USE_OPENMP
-#pragma omp parallel
+#pragma omp parallel for schedule (static,1)
 #endif
-	{
-                const Field_& fieldRef=field();
-#ifdef __LINBOX_USE_OPENMP
-#pragma omp for schedule (static,1024)
-#endif
-                for (size_t i=0;i<y.size();++i) {
-                        new ((void*)(yTemp+i)) FieldAXPY<Field_>(fieldRef);
+        for (long colBand=0;colBand<numColBands;++colBand) {
+                const Index colStart=colBounds_[(size_t)colBand];
+                const Index colEnd=colBounds_[(size_t)colBand+1];
+                std::vector<FieldAXPY<Field_> > yTemp(colEnd-colStart,FieldAXPY<Field_>(field()));
+                for (Index rowBand=0;rowBand<numRowBands;++rowBand) {
+                        const Tile& tile=tiles_[rowBand*(Index)numColBands+(Index)colBand];
+                        for (size_t k=0;k<tile.nnz();++k) {
+                                yTemp[tile.colOffs_[k]].mulacc(tile.elts_[k],x[tile.getRow(k)]);
+                        }
                 }
-
-		Index numBlockSizes=colBlocks_.size();
-		for (Index chunkSizeIx=0;chunkSizeIx<numBlockSizes;++chunkSizeIx) {
-			const VectorChunks *colChunks=&(colBlocks_[chunkSizeIx]);
-			Index numChunks=colChunks->size();
-#ifdef __LINBOX_USE_OPENMP
-#pragma omp for schedule (static,1)
-#endif
-			for (Index colChunk=0;colChunk<numChunks;++colChunk) {
-				const BlockList *blocks=&((*colChunks)[colChunk]);
-				Index numBlocks=blocks->size();
-				for (Index block=0;block<numBlocks;++block) {
-                                        const DataBlock *dataBlock=&((*blocks)[block]);
-					for (Index k=0;k<dataBlock->elts_.size();++k) {
-                                                const Index row=dataBlock->getRow((int)k);
-                                                const Index col=dataBlock->getCol((int)k);
-                                                yTemp[col].mulacc(dataBlock->elts_[k],x[row]);
-					}
-				}
-			}
-			//implicit barrier
-		}
-#ifdef __LINBOX_USE_OPENMP
-#pragma omp for schedule (static,1024)
-#endif
-		for (Index i = 0; i < y.size(); ++i) {
-			yTemp[i].get(y[i]);
-			yTemp[i].~FieldAXPY<Field_>();
-		}
-	}
-
-	delete[] yTempSpace;
+                for (Index j=colStart;j<colEnd;++j) {
+                        yTemp[j-colStart].get(y[j]);
+                }
+        }
+        for (Index j=(colBounds_.empty() ? 0 : colBounds_.back());j<y.size();++j)
+                field().assign(y[j],field().zero);
         return y;
 }
 
@@ -429,117 +271,12 @@ field() const { return MD_.field();}
 template<class Field_>
 size_t SparseMatrix<Field_,SparseMatrixFormat::TPL_omp>::size() const { return data_.size(); }
 
-template<class Field_>
-void SparseMatrix<Field_,SparseMatrixFormat::TPL_omp>::splitBlock(RefBlockList& superBlocks,TriplesBlock startBlock)
-{
-	typedef typename std::vector<Triple>::iterator BlockVecIt;
-
-	std::vector<TriplesBlock> blocks;
-	if (startBlock.nnz()<MAX_BLOCK_NNZ) {
-		--startBlock.blockEnd_;
-		superBlocks.push_back(startBlock);
-	} else {
-		blocks.push_back(startBlock);
-	}
-
-	while(!(blocks.empty())) {
-		TriplesBlock block=blocks.back();
-		blocks.pop_back();
-
-		Triple blockStart(block.blockStart_);
-		Triple blockEnd(block.blockEnd_);
-		TriplesCoord blockSize=block.blockSize();
-		TriplesCoord quarterSize=blockSize>>2;
-		Triple midOne(blockStart.coord_+quarterSize);
-		Triple midTwo(midOne.coord_+quarterSize);
-		Triple midThree(midTwo.coord_+quarterSize);
-
-		BlockVecIt dataBegin=data_.begin()+block.start_;
-		BlockVecIt dataEnd=data_.begin()+block.end_;
-		Index midOneData,midTwoData,midThreeData;
-
-                Triple midOneMM(midOne), midTwoMM(midTwo), midThreeMM(midThree);
-                --midOneMM.coord_; --midTwoMM.coord_; --midThreeMM.coord_;
-		midOneData=std::upper_bound(dataBegin,dataEnd,midOneMM,Triple::compareBlockTriples)-data_.begin();
-		midTwoData=std::upper_bound(dataBegin,dataEnd,midTwoMM,Triple::compareBlockTriples)-data_.begin();
-		midThreeData=std::upper_bound(dataBegin,dataEnd,midThreeMM,Triple::compareBlockTriples)-data_.begin();
-
-		TriplesBlock blockOne(block.start_,midOneData,block.blockStart_,midOne.coord_);
-		TriplesBlock blockTwo(midOneData,midTwoData,midOne.coord_,midTwo.coord_);
-		TriplesBlock blockThree(midTwoData,midThreeData,midTwo.coord_,midThree.coord_);
-		TriplesBlock blockFour(midThreeData,block.end_,midThree.coord_,block.blockEnd_);
-
-		if (blockOne.nnz()<MAX_BLOCK_NNZ) {
-			--blockOne.blockEnd_;
-			superBlocks.push_back(blockOne);
-		} else {
-			blocks.push_back(blockOne);
-		}
-		if (blockTwo.nnz()<MAX_BLOCK_NNZ) {
-			--blockTwo.blockEnd_;
-			superBlocks.push_back(blockTwo);
-		} else {
-			blocks.push_back(blockTwo);
-		}
-		if (blockThree.nnz()<MAX_BLOCK_NNZ) {
-			--blockThree.blockEnd_;
-			superBlocks.push_back(blockThree);
-		} else {
-			blocks.push_back(blockThree);
-		}
-		if (blockFour.nnz()<MAX_BLOCK_NNZ) {
-			--blockFour.blockEnd_;
-			superBlocks.push_back(blockFour);
-		} else {
-			blocks.push_back(blockFour);
-		}
-	}
-}
-
-template<class Field_>
-void SparseMatrix<Field_,SparseMatrixFormat::TPL_omp>::toDataBlock(const RefBlockList& superBlocks,
-				       BlockList& dataBlocks)
-{
-	dataBlocks.clear();
-	dataBlocks.resize(superBlocks.size());
-	for (size_t i=0;i<superBlocks.size();++i) {
-		TriplesBlock block=superBlocks[i];
-		int ccf;
-
-		Index rowDiff=block.getStartRow()^block.getEndRow();
-		Index colDiff=block.getStartCol()^block.getEndCol();
-		Index combinedDiff=rowDiff|colDiff;
-		if ((combinedDiff>>8)==0) {
-			ccf=3;
-		} else if ((combinedDiff>>16) == 0) {
-			ccf=2;
-		} else if ((combinedDiff>>32) == 0) {
-			ccf=1;
-		} else {
-			ccf=0;
-		}
-
-		typename DataBlock::TripleListIt startIt=data_.begin()+block.start_;
-		typename DataBlock::TripleListIt endIt=data_.begin()+block.end_;
-		block.toBlock();
-		TriplesCoord blockSize=block.blockSize();
-                ++blockSize;
-		block.fromBlock();
-		dataBlocks[i].init(block.blockStart_,block.blockEnd_,
-				   blockSize,startIt,endIt,ccf);
-
-	}
-}
-
 template<class Field_>
 void SparseMatrix<Field_,SparseMatrixFormat::TPL_omp>::finalize()
 {
         if ((sortType_ & TRIPLES_SORTED) != 0) {return; }
-        for (Index k=0; k<data_.size();++k) {
-                data_[k].toBlock();
-        }
 
-        std::stable_sort(data_.begin(),data_.end(),Triple::compareBlockTriples);
+        std::stable_sort(data_.begin(),data_.end(),Triple::compareRowCol);
 	std::vector<Triple> tempData;
 	tempData.reserve(data_.size());
 	if (!(data_.empty())) {
@@ -552,33 +289,47 @@ void SparseMatrix<Field_,SparseMatrixFormat::TPL_omp>::finalize()
 	}
 	data_.swap(tempData);
 
-	RefBlockList superBlocks;
-        Index rowBound=roundUpIndex(rowdim());
-        Index colBound=roundUpIndex(coldim());
-        Index rowColBound=(rowBound<colBound)?colBound:rowBound;
-        TriplesCoord startBlockIx(0,0),endBlockIx(0,rowColBound);
-        coordToBlock(endBlockIx);
-        TriplesBlock initialBlock(0,data_.size(),startBlockIx,endBlockIx);
-
-        splitBlock(superBlocks,initialBlock);
-
-        for (Index k=0;k<data_.size();++k) {
-                data_[k].fromBlock();
+#ifdef __LINBOX_USE_OPENMP
+        const Index numThreads=(Index)omp_get_max_threads();
+#else
+        const Index numThreads=1;
+#endif
+        std::vector<size_t> rowCounts(rowdim(),0), colCounts(coldim(),0);
+        for (size_t k=0;k<data_.size();++k) {
+                ++rowCounts[data_[k].getRow()];
+                ++colCounts[data_[k].getCol()];
         }
+        balancedBounds(rowBounds_,rowCounts,numThreads);
+        balancedBounds(colBounds_,colCounts,numThreads);
 
-        std::sort(superBlocks.begin(),superBlocks.end(),TriplesBlock::compareBlockSizes);
-
-	for (Index i=0;i<superBlocks.size();++i) {
-		superBlocks[i].fromBlock();
-	}
-
-	std::vector<DataBlock> dataBlocks;
-	toDataBlock(superBlocks,dataBlocks);
+        const long numRowBands=(long)this->numRowBands();
+        const Index numColBands=this->numColBands();
+        tiles_.clear();
+        tiles_.resize(numRowBands*numColBands);
 
-	rowBlocks_.clear();
-        computeVectors(rowBlocks_,dataBlocks,CHUNK_BY_ROW);
-	colBlocks_.clear();
-        computeVectors(colBlocks_,dataBlocks,CHUNK_BY_COL);
+        // Same distribution as in apply(): the tiles of a row band are
+        // filled, hence first touched, by the thread which will apply them.
+#ifdef __LINBOX_USE_OPENMP
+#pragma omp parallel for schedule (static,1)
+#endif
+        for (long rowBand=0;rowBand<numRowBands;++rowBand) {
+                const Index rowStart=rowBounds_[(size_t)rowBand];
+                const Triple first(rowStart,0,field().zero);
+                const Triple last(rowBounds_[(size_t)rowBand+1],0,field().zero);
+                typename std::vector<Triple>::const_iterator
+                        begin=std::lower_bound(data_.begin(),data_.end(),first,Triple::compareRowCol),
+                        end=std::lower_bound(begin,data_.end(),last,Triple::compareRowCol);
+                Tile* tiles=&(tiles_[(Index)rowBand*numColBands]);
+                for (Index colBand=0;colBand<numColBands;++colBand) {
+                        tiles[colBand].rowStart_=rowStart;
+                        tiles[colBand].colStart_=colBounds_[colBand];
+                }
+                for (;begin!=end;++begin) {
+                        const Index col=begin->getCol();
+                        const Index colBand=(Index)(std::upper_bound(colBounds_.begin(),colBounds_.end(),col)-colBounds_.begin())-1;
+                        tiles[colBand].push_back(begin->getRow(),col,begin->getElt());
+                }
+        }
 
         sortType_=TRIPLES_SORTED;
 }
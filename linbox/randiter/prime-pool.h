@@ -0,0 +1,359 @@
+/* linbox/randiter/prime-pool.h
+ * Copyright (C) 2026 the LinBox group
+ *
+ * ========LICENCE========
+ * This file is part of the library LinBox.
+ *
+ * LinBox is free software: you can redistribute it and/or modify
+ * it under the terms of the  GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ * ========LICENCE========
+ */
+
+/*! @file randiter/prime-pool.h
+ * @ingroup randiter
+ * @brief Persistent pool of word-size primes with precomputed reduction data.
+ *
+ * CRA loops only need "some fresh primes of a given size", but building
+ * them through \c PrimeIterator costs a primality test and a field setup
+ * per iteration. A \c PrimePool<Field> is created once per bit size and
+ * per process; it holds the primes in decreasing order together with
+ * their Barrett/Montgomery constants and a ready-made \p Field, and hands
+ * them out to any number of threads. It can also be filled from a table
+ * of primes saved on disk, which is memory mapped.
+ */
+
+#ifndef __LINBOX_prime_pool_H
+#define __LINBOX_prime_pool_H
+
+#include <algorithm>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <fstream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "linbox/integer.h"
+#include "linbox/util/debug.h"
+#include "linbox/randiter/random-prime.h"
+
+namespace LinBox
+{
+
+	/*! @brief A prime and its precomputed reduction constants.
+	 * @ingroup primes
+	 */
+	struct PrimePoolEntry {
+		uint64_t prime;        //!< \f$p < 2^{63}\f$
+		double   invprime;     //!< \f$1/p\f$, for floating point reduction
+		uint64_t barrett;      //!< \f$\lfloor (2^{64}-1)/p \rfloor\f$
+		uint64_t montgomery;   //!< \f$-p^{-1} \bmod 2^{64}\f$
+		uint64_t montgomeryR2; //!< \f$2^{128} \bmod p\f$, to enter Montgomery form
+
+		PrimePoolEntry() {}
+
+		PrimePoolEntry(uint64_t p) :
+			prime(p), invprime(1./(double)p), barrett((~uint64_t(0))/p)
+		{
+			uint64_t inv = p;        // p*p = 1 mod 8, then Newton doubles the precision
+			for (int i = 0; i < 5; ++i)
+				inv *= 2 - p*inv;
+			montgomery = -inv;
+			integer R2 = (integer(1) << 128) % integer(p);
+			montgomeryR2 = (uint64_t) R2;
+		}
+	};
+
+	/*! @brief Thread-safe, persistent pool of primes of a given bit size.
+	 * @ingroup primes
+	 *
+	 * The pool is a process wide singleton per bit size, see \c instance().
+	 * Primes are the largest primes below \f$2^{bits}\f$, in decreasing
+	 * order; they are generated (and checked) in chunks the first time
+	 * they are asked for, then never again. References to entries and
+	 * fields stay valid for the lifetime of the program.
+	 *
+	 * @tparam Field type of the field built on each prime.
+	 */
+	template<class Field>
+	class PrimePool {
+	public:
+		typedef PrimePoolEntry Entry;
+
+		//! number of primes generated at once when the pool grows
+		static const size_t ChunkSize = 64;
+
+		//! the pool of primes of \p bits bits
+		static PrimePool<Field> & instance(uint64_t bits)
+		{
+			static std::mutex lock;
+			static std::map<uint64_t, std::unique_ptr<PrimePool<Field> > > pools;
+			std::lock_guard<std::mutex> guard(lock);
+			std::unique_ptr<PrimePool<Field> > & P = pools[bits];
+			if (!P)
+				P.reset(new PrimePool<Field>(bits));
+			return *P;
+		}
+
+		uint64_t bits() const { return _bits; }
+
+		//! number of primes currently available without generation
+		size_t size() const
+		{
+			std::lock_guard<std::mutex> guard(_lock);
+			return _entries.size();
+		}
+
+		/** i-th prime of the pool, and its reduction data.
+		 * The lock is only held to find the entry: deques keep references
+		 * valid when they grow and entries are never modified.
+		 */
+		const Entry & entry(size_t i)
+		{
+			std::lock_guard<std::mutex> guard(_lock);
+			_reserve(i+1);
+			return _entries[i];
+		}
+
+		//! prime field modulo the i-th prime of the pool
+		const Field & field(size_t i)
+		{
+			std::lock_guard<std::mutex> guard(_lock);
+			_reserve(i+1);
+			return _fields[i];
+		}
+
+		const uint64_t & prime(size_t i)
+		{
+			return entry(i).prime;
+		}
+
+		//! make sure at least \p n primes are available
+		void reserve(size_t n)
+		{
+			std::lock_guard<std::mutex> guard(_lock);
+			_reserve(n);
+		}
+
+		/** Append the primes of a table written by \c save().
+		 * The file is memory mapped and read once; the primes must be of the
+		 * pool's bit size, in decreasing order. Those below the current
+		 * smallest prime of the pool are tested for primality before they
+		 * are appended.
+		 * @return \c false if the file could not be used; reading stops at
+		 * the first word which is not a prime of \c bits() bits.
+		 */
+		bool load(const std::string & filename)
+		{
+			int fd = ::open(filename.c_str(), O_RDONLY);
+			if (fd < 0) return false;
+			struct stat st;
+			if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(uint64_t)) {
+				::close(fd);
+				return false;
+			}
+			void * map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+			::close(fd);
+			if (map == MAP_FAILED) return false;
+
+			const uint64_t * table = static_cast<const uint64_t*>(map);
+			const size_t nb = (size_t)st.st_size / sizeof(uint64_t) - 1;
+			bool ok = (st.st_size % (off_t)sizeof(uint64_t) == 0) && (table[0] == _bits);
+			if (ok) {
+				const uint64_t low = uint64_t(1) << (_bits-1);
+				std::lock_guard<std::mutex> guard(_lock);
+				for (size_t i = 1; i <= nb; ++i) {
+					if (table[i] >= (uint64_t(1) << _bits) || table[i] < low || !(table[i] & 1)) {
+						ok = false; // not a table of this pool
+						break;
+					}
+					if (table[i] >= _next) continue; // already in the pool
+					if (! _IPD.isprime(integer(table[i]))) {
+						ok = false; // corrupted table
+						break;
+					}
+					_push(table[i]);
+				}
+			}
+			munmap(map, (size_t)st.st_size);
+			return ok;
+		}
+
+		/** Save the primes of the pool: the bit size followed by the
+		 * primes, as raw 64 bits words.
+		 */
+		bool save(const std::string & filename) const
+		{
+			std::ofstream out(filename.c_str(), std::ios::binary);
+			if (!out) return false;
+			const uint64_t b = _bits;
+			out.write(reinterpret_cast<const char*>(&b), sizeof(uint64_t));
+			std::lock_guard<std::mutex> guard(_lock);
+			for (size_t i = 0; i < _entries.size(); ++i)
+				out.write(reinterpret_cast<const char*>(&_entries[i].prime), sizeof(uint64_t));
+			return (bool)out;
+		}
+
+	protected:
+
+		PrimePool(uint64_t bits) :
+			_bits(bits), _next(uint64_t(1) << bits)
+		{
+			linbox_check(bits > 1 && bits < 63);
+		}
+
+		//! \c _lock held
+		void _reserve(size_t n)
+		{
+			while (_entries.size() < n) {
+				size_t before = _entries.size();
+				_generate(ChunkSize);
+				if (_entries.size() == before)
+					throw LinboxError("LinBox ERROR: prime pool exhausted\n");
+			}
+		}
+
+		//! generates up to \p n more primes of \c _bits bits, \c _lock held
+		void _generate(size_t n)
+		{
+			integer p(_next);
+			const uint64_t low = uint64_t(1) << (_bits-1);
+			for (size_t i = 0; i < n; ++i) {
+				_IPD.prevprimein(p);
+				if ((uint64_t)p < low) break;
+				_push((uint64_t)p);
+			}
+		}
+
+		//! \c _lock held
+		void _push(uint64_t p)
+		{
+			_entries.push_back(Entry(p));
+			_fields.push_back(Field(p));
+			_next = p;
+		}
+
+		const uint64_t      _bits;
+		uint64_t            _next;    //!< smallest prime in the pool (exclusive bound for new ones)
+		std::deque<Entry>   _entries; // deque: growing keeps references valid
+		std::deque<Field>   _fields;
+		mutable std::mutex  _lock;
+		Givaro::IntPrimeDom _IPD;
+	};
+
+	/*!  @brief Prime iterator drawing from a \c PrimePool.
+	 * @ingroup primes
+	 * @ingroup randiter
+	 *
+	 * Same interface as \c PrimeIterator, plus access to the precomputed
+	 * field and reduction data of the current prime. Each prime is drawn
+	 * uniformly, without repetition, among the first primes of the pool:
+	 * at least \c Range of them, and twice as many as were drawn. An
+	 * input has fewer bad primes than its size in bits over the size of
+	 * the primes, so early terminated reconstructions stay sound as with
+	 * \c PrimeIterator, while the fields are built once per process.
+	 */
+	template<class Field>
+	class PrimePoolIterator {
+	public:
+		typedef integer Prime_Type ;
+		typedef UniqueSamplingTrait<IteratorCategories::DeterministicTag> UniqueSamplingTag; //!< never repeats a prime
+		typedef IteratorCategories::HeuristicTag IteratorTag;
+
+		//! minimal number of primes among which each prime is drawn
+		static const size_t Range = 4096;
+
+		/*! Constructor.
+		 * @param bits size of primes (in bits).
+		 * @param seed if \c 0 a seed will be generated, otherwise, the
+		 * provided seed will be used to draw the primes.
+		 */
+		PrimePoolIterator(uint64_t bits = 23, uint64_t seed = 0) :
+			_pool(&PrimePool<Field>::instance(bits)),
+			_range(Range),
+			// about half the primes of the size
+			_maxRange(std::max((size_t)1, (size_t)((uint64_t(1) << (bits-1)) / (2*bits))))
+		{
+			if (! seed)
+				seed = BaseTimer::seed();
+			_generator.seed(seed);
+			_range = std::min(_range, _maxRange);
+			_draw();
+		}
+
+		inline PrimePoolIterator<Field> &operator ++ ()
+		{
+			_draw();
+			return *this;
+		}
+
+		const Prime_Type &operator * () const { return _prime; }
+
+		//! the field of the current prime, already set up
+		const Field & field() const { return _pool->field(_index); }
+
+		//! reduction constants of the current prime
+		const PrimePoolEntry & entry() const { return _pool->entry(_index); }
+
+		PrimePool<Field> & pool() const { return *_pool; }
+
+	protected:
+		//! a new random index of the pool, not used before
+		void _draw()
+		{
+			if (2*_used.size() >= _range) {
+				if (_used.size() >= _maxRange)
+					throw LinboxError("LinBox ERROR: prime pool exhausted\n");
+				_range = std::min(2*_range, _maxRange);
+			}
+			std::uniform_int_distribution<size_t> index(0, _range-1);
+			do _index = index(_generator);
+			while (! _used.insert(_index).second);
+			_prime = _pool->prime(_index);
+		}
+
+		PrimePool<Field> * _pool;
+		size_t            _range;    //!< primes are drawn among the first _range ones
+		size_t            _maxRange;
+		std::set<size_t>  _used;
+		std::mt19937_64   _generator;
+		size_t            _index;
+		integer           _prime;
+	};
+
+	//! The CRA loops take the field from the pool instead of building it.
+	template<class Domain>
+	inline Domain CRADomainOf(const PrimePoolIterator<Domain> & primeiter)
+	{
+		return primeiter.field();
+	}
+
+} // namespace LinBox
+
+#endif //__LINBOX_prime_pool_H
+
+// Local Variables:
+// mode: C++
+// tab-width: 4
+// indent-tabs-mode: nil
+// c-basic-offset: 4
+// End:
+// vim:sts=4:sw=4:ts=4:et:sr:cino=>s,f0,{0,g0,(0,\:0,t0,+0,=s
@@ -59,6 +59,36 @@ namespace LinBox
 {
 
 
+#ifdef __SIZEOF_INT128__
+	/*! Specialization of FieldAXPY for the balanced int64_t modular field.
+	 * The products, of absolute value at most \f$p^2/4\f$, are summed in
+	 * a signed 128-bit integer reduced only when the sum could overflow.
+	 */
+	template <>
+	class FieldAXPY<Givaro::ModularBalanced<int64_t> > : public DelayedFieldAXPY<Givaro::ModularBalanced<int64_t>, __int128> {
+	public:
+
+		typedef int64_t Element;
+		typedef Givaro::ModularBalanced<int64_t> Field;
+
+		FieldAXPY (const Field &F) :
+			DelayedFieldAXPY<Field, __int128> (F, (uint64_t) F.characteristic() / 2)
+		{}
+
+		inline Element& get (Element &y) const
+		{
+			DelayedFieldAXPY<Field, __int128>::get (y);
+
+			if (y > field().half_mod)
+				y -= field().characteristic();
+			else if (y < field().mhalf_mod)
+				y += field().characteristic();
+
+			return y;
+		}
+	};
+
+#else
 	template <>
 	class FieldAXPY<Givaro::ModularBalanced<int64_t> > {
 	public:
@@ -156,7 +186,7 @@ namespace LinBox
 		}
 
 	};
-
+#endif // __SIZEOF_INT128__
 
 	template <>
 	class DotProductDomain<Givaro::ModularBalanced<int64_t> > : public virtual VectorDomainBase<Givaro::ModularBalanced<int64_t> > {
@@ -176,7 +206,11 @@ namespace LinBox
 		template <class Vector1, class Vector2>
 		inline Element &dotSpecializedDD (Element &res, const Vector1 &v1, const Vector2 &v2) const
 		{
-
+#ifdef __SIZEOF_INT128__
+			FieldAXPY<Givaro::ModularBalanced<int64_t> > y (field ());
+			y.mulacc (v1.begin (), v1.end (), v2.begin ());
+			return y.get (res);
+#else
 			typename Vector1::const_iterator pv1,pv1e;
 			typename Vector2::const_iterator pv2;
 
@@ -208,13 +242,17 @@ namespace LinBox
 			else if(res < field().mhalf_mod) res += field().characteristic();
 
 			return res;
-
+#endif
 		}
 
 		template <class Vector1, class Vector2>
 		inline Element &dotSpecializedDSP (Element &res, const Vector1 &v1, const Vector2 &v2) const
 		{
-
+#ifdef __SIZEOF_INT128__
+			FieldAXPY<Givaro::ModularBalanced<int64_t> > y (field ());
+			y.mulacc (v1.first.begin (), v1.first.end (), v1.second.begin (), v2);
+			return y.get (res);
+#else
 			typename Vector1::first_type::const_iterator i_idx, i_idxe;
 			typename Vector1::second_type::const_iterator i_elt;
 
@@ -246,6 +284,7 @@ namespace LinBox
 			else if(res < field().mhalf_mod) res += field().characteristic();
 
 			return res;
+#endif
 		}
 
 		inline void normalize(int64_t& _y) const
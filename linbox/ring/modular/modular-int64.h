@@ -35,6 +35,7 @@
 #include "linbox/integer.h"
 #include "linbox/ring/modular.h"
 #include "linbox/vector/vector-domain.h"
+#include "linbox/util/field-axpy.h"
 #include "linbox/field/field-interface.h"
 #include "linbox/field/field-traits.h"
 #include "linbox/util/debug.h"
@@ -61,6 +62,24 @@ namespace LinBox
 	template<class Field>
 	class MVProductDomain;
 
+#ifdef __SIZEOF_INT128__
+	/*! Specialization of FieldAXPY for int64_t modular field.
+	 * The products of two elements, up to \f$2^{126}\f$, are summed in
+	 * 128 bits and reduced only when the sum could overflow.
+	 */
+	template <typename Compute_t>
+	class FieldAXPY<Givaro::Modular<int64_t,Compute_t> > : public DelayedFieldAXPY<Givaro::Modular<int64_t,Compute_t>, unsigned __int128> {
+	public:
+
+		typedef int64_t Element;
+		typedef Givaro::Modular<int64_t,Compute_t> Field;
+
+		FieldAXPY (const Field &F) :
+			DelayedFieldAXPY<Field, unsigned __int128> (F, (uint64_t) F.characteristic() - 1)
+		{}
+	};
+
+#else
 	template <typename Compute_t>
 	class FieldAXPY<Givaro::Modular<int64_t,Compute_t> > {
 	public:
@@ -131,7 +150,7 @@ namespace LinBox
 		const Field *_field;
 		uint64_t _y;
 	};
-
+#endif // __SIZEOF_INT128__
 
 	template <typename Compute_t>
 	class DotProductDomain<Givaro::Modular<int64_t,Compute_t> > : public VectorDomainBase<Givaro::Modular<int64_t,Compute_t> > {
@@ -151,7 +170,11 @@ namespace LinBox
 		template <class Vector1, class Vector2>
 		inline Element &dotSpecializedDD (Element &res, const Vector1 &v1, const Vector2 &v2) const
 		{
-
+#ifdef __SIZEOF_INT128__
+			FieldAXPY<Field> y (field ());
+			y.mulacc (v1.begin (), v1.end (), v2.begin ());
+			return y.get (res);
+#else
 			typename Vector1::const_iterator i;
 			typename Vector2::const_iterator j;
 
@@ -169,12 +192,17 @@ namespace LinBox
 
 			y %= (uint64_t) field().characteristic();
 			return res = (Element)y;
-
+#endif
 		}
 
 		template <class Vector1, class Vector2>
 		inline Element &dotSpecializedDSP (Element &res, const Vector1 &v1, const Vector2 &v2) const
 		{
+#ifdef __SIZEOF_INT128__
+			FieldAXPY<Field> y (field ());
+			y.mulacc (v1.first.begin (), v1.first.end (), v1.second.begin (), v2);
+			return y.get (res);
+#else
 			typename Vector1::first_type::const_iterator i_idx;
 			typename Vector1::second_type::const_iterator i_elt;
 
@@ -194,11 +222,17 @@ namespace LinBox
 			y %= (uint64_t) field().characteristic();
 
 			return res = (Element) y;
+#endif
 		}
 	};
 
-	// Specialization of MVProductDomain for int64_t modular field
-
+#ifdef __SIZEOF_INT128__
+	/*! Specialization of MVProductDomain for int64_t modular field.
+	 * The products are summed in 128 bits, one sum per row of the result.
+	 * A column adds at most one product to each sum, so that the sums
+	 * share the delay of a single accumulator and are reduced together.
+	 * Without 128-bit integers, the generic MVProductDomain is used.
+	 */
 	template <typename Compute_t>
 	class MVProductDomain<Givaro::Modular<int64_t,Compute_t> > {
 	public:
@@ -216,178 +250,117 @@ namespace LinBox
 		}
 
 	private:
+		typedef typename FieldAXPY<Field>::Abnormal Abnormal;
+
+		//! before each column: the sums are reduced once the delay of \p acc is used up
+		void _column (const FieldAXPY<Field> &acc, size_t &left) const
+		{
+			if (!left) {
+				for (typename std::vector<Abnormal>::iterator l = _tmp.begin (); l != _tmp.end (); ++l)
+					acc.reducein (*l);
+				left = acc.delay ();
+			}
+			--left;
+		}
+
+		template <class Vector1>
+		Vector1 &_get (const FieldAXPY<Field> &acc, Vector1 &w) const
+		{
+			typename Vector1::iterator w_j;
+			typename std::vector<Abnormal>::const_iterator l;
+			for (w_j = w.begin (), l = _tmp.begin (); w_j != w.end (); ++w_j, ++l)
+				acc.reduce (*w_j, *l);
+			return w;
+		}
+
 		template <class Vector1, class Matrix, class Vector2>
 		Vector1 &mulColDenseSpecialized
 		(const VectorDomain<Field> &VD, Vector1 &w, const Matrix &A, const Vector2 &v,
 		 VectorCategories::DenseVectorTag) const
-                {
-
-                        linbox_check (A.coldim () == v.size ());
-                        linbox_check (A.rowdim () == w.size ());
-
-                        typename Matrix::ConstColIterator i = A.colBegin ();
-                        typename Vector2::const_iterator j;
-                        typename Matrix::Column::const_iterator k;
-                        std::vector<uint64_t>::iterator l;
-
-                        uint64_t t;
-
-                        if (_tmp.size () < w.size ())
-                                _tmp.resize (w.size ());
-
-                        std::fill (_tmp.begin (), _tmp.begin () + w.size (), 0);
-
-                        for (j = v.begin (); j != v.end (); ++j, ++i)
-                                {
-                                        for (k = i->begin (), l = _tmp.begin (); k != i->end (); ++k, ++l)
-                                                {
-                                                        t = ((uint64_t) *k) * ((uint64_t) *j);
-
-                                                        *l += t;
-
-                                                        if (*l < t)
-                                                                *l += VD.faxpy()._two_64;
-                                                }
-                                }
+		{
+			linbox_check (A.coldim () == v.size ());
+			linbox_check (A.rowdim () == w.size ());
 
-                        typename Vector1::iterator w_j;
+			typename Matrix::ConstColIterator i = A.colBegin ();
+			typename Vector2::const_iterator j;
+			typename Matrix::Column::const_iterator k;
+			typename std::vector<Abnormal>::iterator l;
+
+			FieldAXPY<Field> acc (VD.field ());
+			size_t left = acc.delay ();
+			_tmp.assign (w.size (), Abnormal (0));
+			for (j = v.begin (); j != v.end (); ++j, ++i) {
+				_column (acc, left);
+				const Abnormal x = (Abnormal) *j;
+				for (k = i->begin (), l = _tmp.begin (); k != i->end (); ++k, ++l)
+					*l += (Abnormal) *k * x;
+			}
 
-                        for (w_j = w.begin (), l = _tmp.begin (); w_j != w.end (); ++w_j, ++l)
-                                *w_j = *l % VD.field ().characteristic();
+			return _get (acc, w);
+		}
 
-                        return w;
-                }
 		template <class Vector1, class Matrix, class Vector2>
 		Vector1 &mulColDenseSpecialized
-		(const VectorDomain<Field > &VD, Vector1 &w, const Matrix &A, const Vector2 &v,
+		(const VectorDomain<Field> &VD, Vector1 &w, const Matrix &A, const Vector2 &v,
 		 VectorCategories::SparseSequenceVectorTag) const
-                {
-                        linbox_check (A.coldim () == v.size ());
-                        linbox_check (A.rowdim () == w.size ());
-
-                        typename Matrix::ConstColIterator i = A.colBegin ();
-                        typename Vector2::const_iterator j;
-                        typename Matrix::Column::const_iterator k;
-                        std::vector<uint64_t>::iterator l;
-
-                        uint64_t t;
-
-                        if (_tmp.size () < w.size ())
-                                _tmp.resize (w.size ());
-
-                        std::fill (_tmp.begin (), _tmp.begin () + w.size (), 0);
-
-                        for (j = v.begin (); j != v.end (); ++j, ++i)
-                                {
-                                        for (k = i->begin (), l = _tmp.begin (); k != i->end (); ++k, ++l)
-                                                {
-                                                        t = ((uint64_t) k->second) * ((uint64_t) *j);
-
-                                                        _tmp[k->first] += t;
-
-                                                        if (_tmp[k->first] < t)
-                                                                _tmp[k->first] += VD.faxpy()._two_64;
-                                                }
-                                }
-
-                        typename Vector1::iterator w_j;
+		{
+			linbox_check (A.coldim () == v.size ());
+			linbox_check (A.rowdim () == w.size ());
 
-                        for (w_j = w.begin (), l = _tmp.begin (); w_j != w.end (); ++w_j, ++l)
-                                *w_j = *l % VD.field ().characteristic();
+			typename Matrix::ConstColIterator i = A.colBegin ();
+			typename Vector2::const_iterator j;
+			typename Matrix::Column::const_iterator k;
+
+			FieldAXPY<Field> acc (VD.field ());
+			size_t left = acc.delay ();
+			_tmp.assign (w.size (), Abnormal (0));
+			for (j = v.begin (); j != v.end (); ++j, ++i) {
+				_column (acc, left);
+				const Abnormal x = (Abnormal) *j;
+				for (k = i->begin (); k != i->end (); ++k)
+					_tmp[k->first] += (Abnormal) k->second * x;
+			}
 
-                        return w;
-                }
+			return _get (acc, w);
+		}
 
 		template <class Vector1, class Matrix, class Vector2>
 		Vector1 &mulColDenseSpecialized
-		(const VectorDomain<Field > &VD, Vector1 &w, const Matrix &A, const Vector2 &v,
+		(const VectorDomain<Field> &VD, Vector1 &w, const Matrix &A, const Vector2 &v,
 		 VectorCategories::SparseAssociativeVectorTag) const
-                {
-
-                        linbox_check (A.coldim () == v.size ());
-                        linbox_check (A.rowdim () == w.size ());
-
-                        typename Matrix::ConstColIterator i = A.colBegin ();
-                        typename Vector2::const_iterator j;
-                        typename Matrix::Column::const_iterator k;
-                        std::vector<uint64_t>::iterator l;
-
-                        uint64_t t;
-
-                        if (_tmp.size () < w.size ())
-                                _tmp.resize (w.size ());
-
-                        std::fill (_tmp.begin (), _tmp.begin () + w.size (), 0);
-
-                        for (j = v.begin (); j != v.end (); ++j, ++i)
-                                {
-                                        for (k = i->begin (), l = _tmp.begin (); k != i->end (); ++k, ++l)
-                                                {
-                                                        t = ((uint64_t) k->second) * ((uint64_t) *j);
-
-                                                        _tmp[k->first] += t;
-
-                                                        if (_tmp[k->first] < t)
-                                                                _tmp[k->first] += VD.faxpy()._two_64;
-                                                }
-                                }
-
-                        typename Vector1::iterator w_j;
-
-                        for (w_j = w.begin (), l = _tmp.begin (); w_j != w.end (); ++w_j, ++l)
-                                *w_j = *l % VD.field ().characteristic();
-
-                        return w;
-                }
+		{
+			return mulColDenseSpecialized (VD, w, A, v, VectorCategories::SparseSequenceVectorTag ());
+		}
 
 		template <class Vector1, class Matrix, class Vector2>
 		Vector1 &mulColDenseSpecialized
-		(const VectorDomain<Field > &VD, Vector1 &w, const Matrix &A, const Vector2 &v,
+		(const VectorDomain<Field> &VD, Vector1 &w, const Matrix &A, const Vector2 &v,
 		 VectorCategories::SparseParallelVectorTag) const
-                {
-
-                        linbox_check (A.coldim () == v.size ());
-                        linbox_check (A.rowdim () == w.size ());
-
-                        typename Matrix::ConstColIterator i = A.colBegin ();
-                        typename Vector2::const_iterator j;
-                        typename Matrix::Column::first_type::const_iterator k_idx;
-                        typename Matrix::Column::second_type::const_iterator k_elt;
-                        std::vector<uint64_t>::iterator l;
-
-                        uint64_t t;
-
-                        if (_tmp.size () < w.size ())
-                                _tmp.resize (w.size ());
-
-                        std::fill (_tmp.begin (), _tmp.begin () + w.size (), 0);
-
-                        for (j = v.begin (); j != v.end (); ++j, ++i)
-                                {
-                                        for (k_idx = i->first.begin (), k_elt = i->second.begin (), l = _tmp.begin ();
-                                             k_idx != i->first.end ();
-                                             ++k_idx, ++k_elt, ++l)
-                                                {
-                                                        t = ((uint64_t) *k_elt) * ((uint64_t) *j);
-
-                                                        _tmp[*k_idx] += t;
-
-                                                        if (_tmp[*k_idx] < t)
-                                                                _tmp[*k_idx] += VD.faxpy()._two_64;
-                                                }
-                                }
-
-                        typename Vector1::iterator w_j;
-
-                        for (w_j = w.begin (), l = _tmp.begin (); w_j != w.end (); ++w_j, ++l)
-                                *w_j = *l % VD.field ().characteristic();
+		{
+			linbox_check (A.coldim () == v.size ());
+			linbox_check (A.rowdim () == w.size ());
 
-                        return w;
-                }
+			typename Matrix::ConstColIterator i = A.colBegin ();
+			typename Vector2::const_iterator j;
+			typename Matrix::Column::first_type::const_iterator k_idx;
+			typename Matrix::Column::second_type::const_iterator k_elt;
+
+			FieldAXPY<Field> acc (VD.field ());
+			size_t left = acc.delay ();
+			_tmp.assign (w.size (), Abnormal (0));
+			for (j = v.begin (); j != v.end (); ++j, ++i) {
+				_column (acc, left);
+				const Abnormal x = (Abnormal) *j;
+				for (k_idx = i->first.begin (), k_elt = i->second.begin (); k_idx != i->first.end (); ++k_idx, ++k_elt)
+					_tmp[*k_idx] += (Abnormal) *k_elt * x;
+			}
 
+			return _get (acc, w);
+		}
 
-		mutable std::vector<uint64_t> _tmp;
+		mutable std::vector<Abnormal> _tmp; //!< the sums of the rows
 	};
+#endif // __SIZEOF_INT128__
 }
 
 #undef LINBOX_MAX_INT64
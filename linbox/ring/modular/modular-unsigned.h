@@ -45,6 +45,8 @@
 #define __LINBOX_MIN(a,b) ( (a) < (b) ? (a) : (b) )
 #endif
 
+#include "linbox/util/field-axpy.h"
+
 namespace LinBox { /*  uint8_t */
 
             /*! Specialization of FieldAXPY for uint8_t modular field */
@@ -1160,7 +1162,25 @@ namespace LinBox { /*  uint64_t */
 	template<class Field>
 	class MVProductDomain;
 
-        /*! Specialization of FieldAXPY for unsigned short modular field */
+#ifdef __SIZEOF_INT128__
+        /*! Specialization of FieldAXPY for uint64_t modular field.
+         * The products are summed in 128 bits and reduced only when the sum
+         * could overflow.
+         */
+	template<typename Compute_t>
+	class FieldAXPY<Givaro::Modular<uint64_t,Compute_t> > : public DelayedFieldAXPY<Givaro::Modular<uint64_t,Compute_t>, unsigned __int128> {
+	public:
+
+		typedef uint64_t Element;
+		typedef Givaro::Modular<uint64_t,Compute_t> Field;
+
+		FieldAXPY (const Field &F) :
+			DelayedFieldAXPY<Field, unsigned __int128> (F, (uint64_t) F.characteristic() - 1)
+		{}
+	};
+
+#else
+        /*! Specialization of FieldAXPY for uint64_t modular field */
 
 	template<typename Compute_t>
 	class FieldAXPY<Givaro::Modular<uint64_t,Compute_t> > {
@@ -1241,6 +1261,7 @@ namespace LinBox { /*  uint64_t */
 		const Field *_field;
 		uint64_t _y;
 	};
+#endif // __SIZEOF_INT128__
 
         //! Specialization of DotProductDomain for uint64_t modular field
 
@@ -1262,7 +1283,11 @@ namespace LinBox { /*  uint64_t */
 		template <class Vector1, class Vector2>
             inline Element &dotSpecializedDD (Element &res, const Vector1 &v1, const Vector2 &v2) const
         {
-
+#ifdef __SIZEOF_INT128__
+			FieldAXPY<Field> y (field ());
+			y.mulacc (v1.begin (), v1.end (), v2.begin ());
+			return y.get (res);
+#else
 			typename Vector1::const_iterator i;
 			typename Vector2::const_iterator j;
 
@@ -1280,12 +1305,17 @@ namespace LinBox { /*  uint64_t */
 
 			y %= (uint64_t) field().characteristic();
 			return res = (Element)y;
-
+#endif
 		}
 
 		template <class Vector1, class Vector2>
             inline Element &dotSpecializedDSP (Element &res, const Vector1 &v1, const Vector2 &v2) const
 		{
+#ifdef __SIZEOF_INT128__
+			FieldAXPY<Field> y (field ());
+			y.mulacc (v1.first.begin (), v1.first.end (), v1.second.begin (), v2);
+			return y.get (res);
+#else
 			typename Vector1::first_type::const_iterator i_idx;
 			typename Vector1::second_type::const_iterator i_elt;
 
@@ -1305,13 +1335,19 @@ namespace LinBox { /*  uint64_t */
 			y %= (uint64_t) field().characteristic();
 
 			return res = (Element) y;
-		}	
+#endif
+		}
 
         
 	};
 
-        //! Specialization of MVProductDomain for uint64_t modular field
-
+#ifdef __SIZEOF_INT128__
+	/*! Specialization of MVProductDomain for uint64_t modular field.
+	 * The products are summed in 128 bits, one sum per row of the result.
+	 * A column adds at most one product to each sum, so that the sums
+	 * share the delay of a single accumulator and are reduced together.
+	 * Without 128-bit integers, the generic MVProductDomain is used.
+	 */
 	template <typename Compute_t>
 	class MVProductDomain<Givaro::Modular<uint64_t,Compute_t> > {
 	public:
@@ -1322,31 +1358,124 @@ namespace LinBox { /*  uint64_t */
 	protected:
 		template <class Vector1, class Matrix, class Vector2>
 		inline Vector1 &mulColDense
-		(const VectorDomain<Field > &VD, Vector1 &w, const Matrix &A, const Vector2 &v) const
-            {
-                return mulColDenseSpecialized (VD, w, A, v, typename VectorTraits<typename Matrix::Column>::VectorCategory ());
-            }
+		(const VectorDomain<Field> &VD, Vector1 &w, const Matrix &A, const Vector2 &v) const
+		{
+			return mulColDenseSpecialized
+			(VD, w, A, v, typename VectorTraits<typename Matrix::Column>::VectorCategory ());
+		}
 
 	private:
+		typedef typename FieldAXPY<Field>::Abnormal Abnormal;
+
+		//! before each column: the sums are reduced once the delay of \p acc is used up
+		void _column (const FieldAXPY<Field> &acc, size_t &left) const
+		{
+			if (!left) {
+				for (typename std::vector<Abnormal>::iterator l = _tmp.begin (); l != _tmp.end (); ++l)
+					acc.reducein (*l);
+				left = acc.delay ();
+			}
+			--left;
+		}
+
+		template <class Vector1>
+		Vector1 &_get (const FieldAXPY<Field> &acc, Vector1 &w) const
+		{
+			typename Vector1::iterator w_j;
+			typename std::vector<Abnormal>::const_iterator l;
+			for (w_j = w.begin (), l = _tmp.begin (); w_j != w.end (); ++w_j, ++l)
+				acc.reduce (*w_j, *l);
+			return w;
+		}
+
 		template <class Vector1, class Matrix, class Vector2>
 		Vector1 &mulColDenseSpecialized
-		(const VectorDomain<Field > &VD, Vector1 &w, const Matrix &A, const Vector2 &v,
-		 VectorCategories::DenseVectorTag) const;
+		(const VectorDomain<Field> &VD, Vector1 &w, const Matrix &A, const Vector2 &v,
+		 VectorCategories::DenseVectorTag) const
+		{
+			linbox_check (A.coldim () == v.size ());
+			linbox_check (A.rowdim () == w.size ());
+
+			typename Matrix::ConstColIterator i = A.colBegin ();
+			typename Vector2::const_iterator j;
+			typename Matrix::Column::const_iterator k;
+			typename std::vector<Abnormal>::iterator l;
+
+			FieldAXPY<Field> acc (VD.field ());
+			size_t left = acc.delay ();
+			_tmp.assign (w.size (), Abnormal (0));
+			for (j = v.begin (); j != v.end (); ++j, ++i) {
+				_column (acc, left);
+				const Abnormal x = (Abnormal) *j;
+				for (k = i->begin (), l = _tmp.begin (); k != i->end (); ++k, ++l)
+					*l += (Abnormal) *k * x;
+			}
+
+			return _get (acc, w);
+		}
+
 		template <class Vector1, class Matrix, class Vector2>
 		Vector1 &mulColDenseSpecialized
-		(const VectorDomain<Field > &VD, Vector1 &w, const Matrix &A, const Vector2 &v,
-		 VectorCategories::SparseSequenceVectorTag) const;
+		(const VectorDomain<Field> &VD, Vector1 &w, const Matrix &A, const Vector2 &v,
+		 VectorCategories::SparseSequenceVectorTag) const
+		{
+			linbox_check (A.coldim () == v.size ());
+			linbox_check (A.rowdim () == w.size ());
+
+			typename Matrix::ConstColIterator i = A.colBegin ();
+			typename Vector2::const_iterator j;
+			typename Matrix::Column::const_iterator k;
+
+			FieldAXPY<Field> acc (VD.field ());
+			size_t left = acc.delay ();
+			_tmp.assign (w.size (), Abnormal (0));
+			for (j = v.begin (); j != v.end (); ++j, ++i) {
+				_column (acc, left);
+				const Abnormal x = (Abnormal) *j;
+				for (k = i->begin (); k != i->end (); ++k)
+					_tmp[k->first] += (Abnormal) k->second * x;
+			}
+
+			return _get (acc, w);
+		}
+
 		template <class Vector1, class Matrix, class Vector2>
 		Vector1 &mulColDenseSpecialized
-		(const VectorDomain<Field > &VD, Vector1 &w, const Matrix &A, const Vector2 &v,
-		 VectorCategories::SparseAssociativeVectorTag) const;
+		(const VectorDomain<Field> &VD, Vector1 &w, const Matrix &A, const Vector2 &v,
+		 VectorCategories::SparseAssociativeVectorTag) const
+		{
+			return mulColDenseSpecialized (VD, w, A, v, VectorCategories::SparseSequenceVectorTag ());
+		}
+
 		template <class Vector1, class Matrix, class Vector2>
 		Vector1 &mulColDenseSpecialized
-		(const VectorDomain<Field > &VD, Vector1 &w, const Matrix &A, const Vector2 &v,
-		 VectorCategories::SparseParallelVectorTag) const;
+		(const VectorDomain<Field> &VD, Vector1 &w, const Matrix &A, const Vector2 &v,
+		 VectorCategories::SparseParallelVectorTag) const
+		{
+			linbox_check (A.coldim () == v.size ());
+			linbox_check (A.rowdim () == w.size ());
 
-		mutable std::vector<uint64_t> _tmp;
+			typename Matrix::ConstColIterator i = A.colBegin ();
+			typename Vector2::const_iterator j;
+			typename Matrix::Column::first_type::const_iterator k_idx;
+			typename Matrix::Column::second_type::const_iterator k_elt;
+
+			FieldAXPY<Field> acc (VD.field ());
+			size_t left = acc.delay ();
+			_tmp.assign (w.size (), Abnormal (0));
+			for (j = v.begin (); j != v.end (); ++j, ++i) {
+				_column (acc, left);
+				const Abnormal x = (Abnormal) *j;
+				for (k_idx = i->first.begin (), k_elt = i->second.begin (); k_idx != i->first.end (); ++k_idx, ++k_elt)
+					_tmp[*k_idx] += (Abnormal) *k_elt * x;
+			}
+
+			return _get (acc, w);
+		}
+
+		mutable std::vector<Abnormal> _tmp; //!< the sums of the rows
 	};
+#endif // __SIZEOF_INT128__
 
 }
 
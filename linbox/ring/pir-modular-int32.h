@@ -28,6 +28,7 @@
 #include <givaro/modular-int32.h>
 //#include <linbox/util/debug.h>
 #include <linbox/vector/vector-domain.h>
+#include <linbox/util/field-axpy.h>
 
 //#include "linbox/ring/modular.h"
 #ifndef LINBOX_MAX_INT
@@ -378,6 +379,21 @@ namespace LinBox
 
 	};
 
+#ifdef __SIZEOF_INT128__
+	// the products are below 2^62: 2^64 of them fit in 128 bits
+	template <>
+	class FieldAXPY<PIRModular<int32_t> > : public DelayedFieldAXPY<PIRModular<int32_t>, unsigned __int128> {
+	public:
+
+		typedef int32_t Element;
+		typedef PIRModular<int32_t> Field;
+
+		FieldAXPY (const Field &F) :
+			DelayedFieldAXPY<Field, unsigned __int128> (F, (uint64_t) F.characteristic() - 1)
+		{}
+	};
+
+#else
 	template <>
 	class FieldAXPY<PIRModular<int32_t> > {
 	public:
@@ -438,7 +454,7 @@ namespace LinBox
 		const Field &_field;
 		uint64_t _y;
 	};
-
+#endif // __SIZEOF_INT128__
 
 	template <>
 	class DotProductDomain<PIRModular<int32_t> > : public  VectorDomainBase<PIRModular<int32_t> > {
@@ -454,7 +470,11 @@ namespace LinBox
 		template <class Vector1, class Vector2>
 		inline Element &dotSpecializedDD (Element &res, const Vector1 &v1, const Vector2 &v2) const
 		{
-
+#ifdef __SIZEOF_INT128__
+			FieldAXPY<PIRModular<int32_t> > y (field ());
+			y.mulacc (v1.begin (), v1.end (), v2.begin ());
+			return y.get (res);
+#else
 			typename Vector1::const_iterator i;
 			typename Vector2::const_iterator j;
 
@@ -471,12 +491,17 @@ namespace LinBox
 
 			y %= (uint64_t) field().characteristic();
 			return res = Element(y);
-
+#endif
 		}
 
 		template <class Vector1, class Vector2>
 		inline Element &dotSpecializedDSP (Element &res, const Vector1 &v1, const Vector2 &v2) const
 		{
+#ifdef __SIZEOF_INT128__
+			FieldAXPY<PIRModular<int32_t> > y (field ());
+			y.mulacc (v1.first.begin (), v1.first.end (), v1.second.begin (), v2);
+			return y.get (res);
+#else
 			typename Vector1::first_type::const_iterator i_idx;
 			typename Vector1::second_type::const_iterator i_elt;
 
@@ -495,6 +520,7 @@ namespace LinBox
 			y %= (uint64_t) field().characteristic();
 
 			return res = (Element)y;
+#endif
 		}
 	};
 
@@ -315,6 +315,7 @@ namespace LinBox
 #include "linbox/algorithms/cra-domain.h"
 #include "linbox/algorithms/cra-full-multip.h"
 #include "linbox/algorithms/cra-early-multip.h"
+#include "linbox/randiter/prime-pool.h"
 #include "linbox/algorithms/matrix-hom.h"
 
 namespace LinBox
@@ -364,7 +365,7 @@ namespace LinBox
 		commentator().start ("Integer BlackBox Charpoly : No NTL installation -> chinese remaindering", "IbbCharpoly");
 
         typedef Givaro::ModularBalanced<double> Field;
-		PrimeIterator<IteratorCategories::HeuristicTag> genprime(FieldTraits<Field>::bestBitSize(A.coldim()));
+		PrimePoolIterator<Field> genprime(FieldTraits<Field>::bestBitSize(A.coldim()));
 #if 0
 		typename Blackbox::ConstIterator it = A.Begin();
 		typename Blackbox::ConstIterator it_end = A.End();
@@ -408,7 +409,7 @@ namespace LinBox
 		commentator().start ("Integer Dense Charpoly : No NTL installation -> chinese remaindering", "IbbCharpoly");
 
         typedef Givaro::ModularBalanced<double> Field;
-		PrimeIterator<IteratorCategories::HeuristicTag> genprime(FieldTraits<Field>::bestBitSize(A.coldim()));
+		PrimePoolIterator<Field> genprime(FieldTraits<Field>::bestBitSize(A.coldim()));
 #if 0
 		typename Blackbox::ConstIterator it = A.Begin();
 		typename Blackbox::ConstIterator it_end = A.End();
@@ -347,6 +347,41 @@ namespace LinBox
 		return d;
 	}
 
+	// the det with Blas on a matrix stored out of core
+	template <class Field>
+	typename Field::Element &det (typename Field::Element                 &d,
+				      const TiledBlasMatrix<Field>            &A,
+				      const RingCategories::ModularTag        &tag,
+				      const Method::BlasElimination           &Meth)
+	{
+		if (A.coldim() != A.rowdim())
+			throw LinboxError("LinBox ERROR: matrix must be square for determinant computation\n");
+
+		commentator().start ("Tiled Blas Determinant", "tileddet");
+		BlasMatrixDomain<Field> BMD(A.field());
+		d = BMD.det(A);
+		commentator().stop ("done", NULL, "tileddet");
+
+		return d;
+	}
+
+	template <class Field>
+	typename Field::Element &detin (typename Field::Element                 &d,
+					TiledBlasMatrix<Field>                  &A,
+					const RingCategories::ModularTag        &tag,
+					const Method::BlasElimination           &Meth)
+	{
+		if (A.coldim() != A.rowdim())
+			throw LinboxError("LinBox ERROR: matrix must be square for determinant computation\n");
+
+		commentator().start ("Tiled Blas Determinant", "tileddet");
+		BlasMatrixDomain<Field> BMD(A.field());
+		d = BMD.detin(A);
+		commentator().stop ("done", NULL, "tileddet");
+
+		return d;
+	}
+
 	template <class Blackbox>
 	typename Blackbox::Field::Element &det (typename Blackbox::Field::Element	&d,
 						const Blackbox  			&A,
@@ -530,6 +565,7 @@ namespace LinBox
 
 #include "linbox/algorithms/cra-early-single.h"
 #include "linbox/randiter/random-prime.h"
+#include "linbox/randiter/prime-pool.h"
 #include "linbox/algorithms/matrix-hom.h"
 
 namespace LinBox
@@ -575,7 +611,8 @@ namespace LinBox
 		// 0.7213475205 is an upper approximation of 1/(2log(2))
 		IntegerModularDet<Blackbox, MyMethod> iteration(A, Meth);
                 typedef Givaro::ModularBalanced<double> Field;
-                PrimeIterator<IteratorCategories::HeuristicTag> genprime(FieldTraits<Field>::bestBitSize(A.coldim()));
+		// random primes of a pool: the fields are built once per process
+                PrimePoolIterator<Field> genprime(FieldTraits<Field>::bestBitSize(A.coldim()));
 		integer dd; // use of integer due to non genericity of cra. PG 2005-08-04
 
 		//  will call regular cra if C=0
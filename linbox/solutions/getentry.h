@@ -27,9 +27,15 @@
 #ifndef __LINBOX_getentry_H
 #define __LINBOX_getentry_H
 
+#include <vector>
+#include <utility>
+
 #include "linbox/matrix/sparse-matrix.h"
 #include "linbox/blackbox/compose.h"
 #include "linbox/blackbox/diagonal.h"
+#include "linbox/blackbox/scalar-matrix.h"
+#include "linbox/blackbox/transpose.h"
+#include "linbox/blackbox/sum.h"
 #include "linbox/solutions/methods.h"
 #include "linbox/solutions/solution-tags.h"
 
@@ -67,6 +73,46 @@ namespace LinBox
 	 */
 	template<class BB> struct GetEntryCategory;
 
+	/** \brief Entries \f$x_l = A_{i_l,j_l}\f$ for a list of positions.
+	 *
+	 * When getEntry is not local, the positions are grouped by column and
+	 * each column costs one apply, or the entries of \p A are listed once
+	 * if it can list them (see EntriesCategory). Products, sums and
+	 * transposes are handled through their factors.
+	 * @param x resized to the number of positions
+	 */
+	template <class Vector, class BB>
+	Vector& getEntries(Vector& x, const BB& A, const std::vector<std::pair<size_t, size_t> >& ij);
+
+	/** \brief The diagonal \f$d_i = A_{i,i}\f$, \f$i < \min(m,n)\f$.
+	 *
+	 * The diagonal of a product \f$BC\f$ is \f$d_i = \sum_k B_{ik}C_{ki}\f$,
+	 * the intersection of the row \f$i\f$ of \f$B\f$ with the column
+	 * \f$i\f$ of \f$C\f$: if both factors list their entries, it costs
+	 * a sort of these entries instead of \f$\min(m,n)\f$ applies. Diagonal
+	 * factors scale the diagonal of the other one, and the diagonal of a
+	 * sum or of a transpose is read from the blackboxes it is made of.
+	 * @param d resized to \f$\min(m,n)\f$
+	 */
+	template <class Vector, class BB>
+	Vector& getDiagonal(Vector& d, const BB& A);
+
+	/** \brief Calls \f$f(i, j, a)\f$ on entries \f$a = A_{i,j}\f$ of \p A.
+	 *
+	 * Every nonzero entry is listed; an entry may be split in several
+	 * terms, listed separately, whose sum is the entry. Blackboxes with
+	 * an indexed iterator or \c nextTriple list their stored entries, and
+	 * so do the transposes, sums and products by diagonal matrices of
+	 * those. Others are applied to each unit vector.
+	 */
+	template <class BB, class Function>
+	void forEachEntry(const BB& A, Function f);
+
+	/** EntriesCategory is Local for the BB classes whose entries
+	 * forEachEntry lists without applies.
+	 */
+	template<class BB> struct EntriesCategory;
+
 /************************** internal forms **********************/
 	// For the general case apply() will be used.
 	template <class BB>
@@ -76,6 +122,18 @@ namespace LinBox
 	template <class BB>
 	typename BB::Field::Element& getEntry(typename BB::Field::Element& x, const BB& A, const size_t i, const size_t j, SolutionTags::Local t );
 
+	template <class Vector, class BB>
+	Vector& getEntries(Vector& x, const BB& A, const std::vector<std::pair<size_t, size_t> >& ij, SolutionTags::Generic t);
+
+	template <class Vector, class BB>
+	Vector& getEntries(Vector& x, const BB& A, const std::vector<std::pair<size_t, size_t> >& ij, SolutionTags::Local t);
+
+	template <class Vector, class BB>
+	Vector& getDiagonal(Vector& d, const BB& A, SolutionTags::Generic t);
+
+	template <class Vector, class BB>
+	Vector& getDiagonal(Vector& d, const BB& A, SolutionTags::Local t);
+
 } // LinBox
 
 #include "linbox/solutions/getentry.inl"
@@ -28,6 +28,8 @@
 #define __LINBOX_getentry_INL
 
 #include <vector>
+#include <utility>
+#include <algorithm>
 
 #include "linbox/util/debug.h"
 #include "linbox/vector/vector-domain.h"
@@ -37,6 +39,8 @@
 #include "linbox/blackbox/scalar-matrix.h"
 #include "linbox/blackbox/compose.h"
 #include "linbox/blackbox/diagonal.h"
+#include "linbox/blackbox/transpose.h"
+#include "linbox/blackbox/sum.h"
 #include "linbox/solutions/methods.h"
 #include "linbox/solutions/solution-tags.h"
 #include "linbox/vector/blas-vector.h"
@@ -114,6 +118,392 @@ namespace LinBox
         return A.field().mulin(x, y);
 	}
 
+	/*-------- listing the entries --------*/
+
+	// Blackboxes with an indexed iterator or nextTriple list their entries
+	template<class IT> struct IndexedEntries { typedef SolutionTags::Local Tag; };
+	template<> struct IndexedEntries<IndexedTags::NoIndexed> { typedef SolutionTags::Generic Tag; };
+
+	template<class T1, class T2> struct BothEntries { typedef SolutionTags::Generic Tag; };
+	template<> struct BothEntries<SolutionTags::Local, SolutionTags::Local> { typedef SolutionTags::Local Tag; };
+
+	template<class BB> struct EntriesCategory
+	{ typedef typename IndexedEntries<typename IndexedCategory<BB>::Tag>::Tag Tag; };
+
+	template<class Field, class Trait> struct EntriesCategory<Diagonal<Field, Trait> >
+	{ typedef SolutionTags::Local Tag; };
+
+	template<class Field> struct EntriesCategory<ScalarMatrix<Field> >
+	{ typedef SolutionTags::Local Tag; };
+
+	template<class BB> struct EntriesCategory<Transpose<BB> >
+	{ typedef typename EntriesCategory<BB>::Tag Tag; };
+
+	template<class BB1, class BB2> struct EntriesCategory<Sum<BB1, BB2> >
+	{ typedef typename BothEntries<typename EntriesCategory<BB1>::Tag, typename EntriesCategory<BB2>::Tag>::Tag Tag; };
+
+	template<class Field, class Trait, class BB> struct EntriesCategory<Compose<Diagonal<Field, Trait>, BB> >
+	{ typedef typename EntriesCategory<BB>::Tag Tag; };
+
+	template<class BB, class Field, class Trait> struct EntriesCategory<Compose<BB, Diagonal<Field, Trait> > >
+	{ typedef typename EntriesCategory<BB>::Tag Tag; };
+
+	template<class Field, class T1, class T2> struct EntriesCategory<Compose<Diagonal<Field, T1>, Diagonal<Field, T2> > >
+	{ typedef SolutionTags::Local Tag; };
+
+	// a Compose<BB, BB> may be the product of more than two blackboxes
+	template <class BB1, class BB2>
+	size_t composeLength(const Compose<BB1, BB2>&) { return 2; }
+
+	template <class BB>
+	size_t composeLength(const Compose<BB, BB>& A) { return A.length(); }
+
+	template <class BB, class Function>
+	void forEachEntry(const BB& A, Function f)
+	{
+		typename IndexedCategory<BB>::Tag t;
+		forEachEntry(A, f, t);
+	}
+
+	template <class BB, class Function>
+	void forEachEntry(const BB& A, Function f, IndexedTags::HasIndexed t)
+	{
+		for (typename BB::ConstIndexedIterator it = A.IndexedBegin(); it != A.IndexedEnd(); ++it)
+			f(it.rowIndex(), it.colIndex(), it.value());
+	}
+
+	template <class BB, class Function>
+	void forEachEntry(const BB& A, Function f, IndexedTags::HasNext t)
+	{
+		size_t i, j;
+		typename BB::Field::Element a;
+		A.firstTriple();
+		while (A.nextTriple(i, j, a))
+			f(i, j, a);
+		A.firstTriple();
+	}
+
+	// the nonzero entries of the columns A e_j
+	template <class BB, class Function>
+	void forEachEntry(const BB& A, Function f, IndexedTags::NoIndexed t)
+	{
+		typedef typename BB::Field Field;
+		const Field& F = A.field();
+		BlasVector<Field> v(F, A.coldim(), F.zero), w(F, A.rowdim(), F.zero);
+		for (size_t j = 0; j < A.coldim(); ++j) {
+			F.assign(v[j], F.one);
+			A.apply(w, v);
+			F.assign(v[j], F.zero);
+			for (size_t i = 0; i < A.rowdim(); ++i)
+				if (!F.isZero(w[i]))
+					f(i, j, w[i]);
+		}
+	}
+
+	template <class Field, class Trait, class Function>
+	void forEachEntry(const Diagonal<Field, Trait>& A, Function f)
+	{
+		typename Field::Element x;
+		for (size_t i = 0; i < A.rowdim(); ++i)
+			if (!A.field().isZero(A.getEntry(x, i, i)))
+				f(i, i, x);
+	}
+
+	template <class Field, class Function>
+	void forEachEntry(const ScalarMatrix<Field>& A, Function f)
+	{
+		typename Field::Element x;
+		if (A.field().isZero(A.getEntry(x, 0, 0)))
+			return;
+		for (size_t i = 0; i < A.rowdim(); ++i)
+			f(i, i, x);
+	}
+
+	template <class BB, class Function>
+	void forEachEntry(const Transpose<BB>& A, Function f)
+	{
+		typedef typename BB::Field::Element Element;
+		forEachEntry(*A.getPtr(), [&f] (size_t i, size_t j, const Element& a) { f(j, i, a); });
+	}
+
+	template <class BB1, class BB2, class Function>
+	void forEachEntry(const Sum<BB1, BB2>& A, Function f)
+	{
+		forEachEntry(*A.getLeftPtr(), f);
+		forEachEntry(*A.getRightPtr(), f);
+	}
+
+	template <class Field, class Trait, class BB, class Function>
+	void forEachEntry(const Compose<Diagonal<Field, Trait>, BB>& A, Function f)
+	{
+		if (composeLength(A) != 2)
+			return forEachEntry(A, f, IndexedTags::NoIndexed());
+		const Diagonal<Field, Trait>& D = *A.getLeftPtr();
+		const Field& F = A.field();
+		forEachEntry(*A.getRightPtr(), [&] (size_t i, size_t j, const typename Field::Element& a) {
+			typename Field::Element x;
+			D.getEntry(x, i, i);
+			f(i, j, F.mulin(x, a));
+		});
+	}
+
+	template <class BB, class Field, class Trait, class Function>
+	void forEachEntry(const Compose<BB, Diagonal<Field, Trait> >& A, Function f)
+	{
+		if (composeLength(A) != 2)
+			return forEachEntry(A, f, IndexedTags::NoIndexed());
+		const Diagonal<Field, Trait>& D = *A.getRightPtr();
+		const Field& F = A.field();
+		forEachEntry(*A.getLeftPtr(), [&] (size_t i, size_t j, const typename Field::Element& a) {
+			typename Field::Element x;
+			D.getEntry(x, j, j);
+			f(i, j, F.mulin(x, a));
+		});
+	}
+
+	template <class Field, class T1, class T2, class Function>
+	void forEachEntry(const Compose<Diagonal<Field, T1>, Diagonal<Field, T2> >& A, Function f)
+	{
+		if (composeLength(A) != 2)
+			return forEachEntry(A, f, IndexedTags::NoIndexed());
+		const Field& F = A.field();
+		typename Field::Element x, y;
+		for (size_t i = 0; i < A.rowdim(); ++i) {
+			A.getLeftPtr()->getEntry(x, i, i);
+			A.getRightPtr()->getEntry(y, i, i);
+			if (!F.isZero(F.mulin(x, y)))
+				f(i, i, x);
+		}
+	}
+
+	/*-------- batches of entries --------*/
+
+	template <class Vector, class BB>
+	Vector& getEntries(Vector& x, const BB& A, const std::vector<std::pair<size_t, size_t> >& ij)
+	{
+		typename GetEntryCategory<BB>::Tag t;
+		return getEntries(x, A, ij, t);
+	}
+
+	template <class Vector, class BB>
+	Vector& getEntries(Vector& x, const BB& A, const std::vector<std::pair<size_t, size_t> >& ij, SolutionTags::Local t)
+	{
+		x.resize(ij.size());
+		for (size_t l = 0; l < ij.size(); ++l)
+			A.getEntry(x[l], ij[l].first, ij[l].second);
+		return x;
+	}
+
+	template <class Vector, class BB>
+	Vector& getEntries(Vector& x, const BB& A, const std::vector<std::pair<size_t, size_t> >& ij, SolutionTags::Generic t)
+	{
+		typename EntriesCategory<BB>::Tag e;
+		return collectEntries(x, A, ij, e);
+	}
+
+	// the listed entries of A are added to the positions asked for
+	template <class Vector, class BB>
+	Vector& collectEntries(Vector& x, const BB& A, const std::vector<std::pair<size_t, size_t> >& ij, SolutionTags::Local t)
+	{
+		typedef typename BB::Field::Element Element;
+		typedef std::pair<std::pair<size_t, size_t>, size_t> Query;
+		std::vector<Query> q(ij.size());
+		for (size_t l = 0; l < ij.size(); ++l)
+			q[l] = Query(ij[l], l);
+		std::sort(q.begin(), q.end());
+
+		const typename BB::Field& F = A.field();
+		x.resize(ij.size());
+		for (size_t l = 0; l < ij.size(); ++l)
+			F.assign(x[l], F.zero);
+		auto position = [] (const Query& u, const Query& v) { return u.first < v.first; };
+		forEachEntry(A, [&] (size_t i, size_t j, const Element& a) {
+			auto r = std::equal_range(q.begin(), q.end(), Query(std::make_pair(i, j), 0), position);
+			for (; r.first != r.second; ++r.first)
+				F.addin(x[r.first->second], a);
+		});
+		return x;
+	}
+
+	// one apply per column asked for
+	template <class Vector, class BB>
+	Vector& collectEntries(Vector& x, const BB& A, const std::vector<std::pair<size_t, size_t> >& ij, SolutionTags::Generic t)
+	{
+		typedef typename BB::Field Field;
+		const Field& F = A.field();
+		std::vector<size_t> o(ij.size());
+		for (size_t l = 0; l < o.size(); ++l)
+			o[l] = l;
+		std::sort(o.begin(), o.end(), [&ij] (size_t u, size_t v) { return ij[u].second < ij[v].second; });
+
+		x.resize(ij.size());
+		BlasVector<Field> v(F, A.coldim(), F.zero), w(F, A.rowdim(), F.zero);
+		for (size_t l = 0; l < o.size(); ) {
+			const size_t j = ij[o[l]].second;
+			F.assign(v[j], F.one);
+			A.apply(w, v);
+			F.assign(v[j], F.zero);
+			for (; l < o.size() && ij[o[l]].second == j; ++l)
+				F.assign(x[o[l]], w[ij[o[l]].first]);
+		}
+		return x;
+	}
+
+	template <class Vector, class BB>
+	Vector& getEntries(Vector& x, const Transpose<BB>& A, const std::vector<std::pair<size_t, size_t> >& ij)
+	{
+		std::vector<std::pair<size_t, size_t> > ji(ij.size());
+		for (size_t l = 0; l < ij.size(); ++l)
+			ji[l] = std::make_pair(ij[l].second, ij[l].first);
+		return getEntries(x, *A.getPtr(), ji);
+	}
+
+	template <class Vector, class BB1, class BB2>
+	Vector& getEntries(Vector& x, const Sum<BB1, BB2>& A, const std::vector<std::pair<size_t, size_t> >& ij)
+	{
+		std::vector<typename BB1::Field::Element> y;
+		getEntries(x, *A.getLeftPtr(), ij);
+		getEntries(y, *A.getRightPtr(), ij);
+		for (size_t l = 0; l < ij.size(); ++l)
+			A.field().addin(x[l], y[l]);
+		return x;
+	}
+
+	template <class Vector, class Field, class Trait, class BB>
+	Vector& getEntries(Vector& x, const Compose<Diagonal<Field, Trait>, BB>& A, const std::vector<std::pair<size_t, size_t> >& ij)
+	{
+		if (composeLength(A) != 2)
+			return getEntries(x, A, ij, SolutionTags::Generic());
+		typename Field::Element d;
+		getEntries(x, *A.getRightPtr(), ij);
+		for (size_t l = 0; l < ij.size(); ++l)
+			A.field().mulin(x[l], A.getLeftPtr()->getEntry(d, ij[l].first, ij[l].first));
+		return x;
+	}
+
+	template <class Vector, class BB, class Field, class Trait>
+	Vector& getEntries(Vector& x, const Compose<BB, Diagonal<Field, Trait> >& A, const std::vector<std::pair<size_t, size_t> >& ij)
+	{
+		if (composeLength(A) != 2)
+			return getEntries(x, A, ij, SolutionTags::Generic());
+		typename Field::Element d;
+		getEntries(x, *A.getLeftPtr(), ij);
+		for (size_t l = 0; l < ij.size(); ++l)
+			A.field().mulin(x[l], A.getRightPtr()->getEntry(d, ij[l].second, ij[l].second));
+		return x;
+	}
+
+	template <class Vector, class Field, class T1, class T2>
+	Vector& getEntries(Vector& x, const Compose<Diagonal<Field, T1>, Diagonal<Field, T2> >& A, const std::vector<std::pair<size_t, size_t> >& ij)
+	{
+		if (composeLength(A) != 2)
+			return getEntries(x, A, ij, SolutionTags::Generic());
+		x.resize(ij.size());
+		for (size_t l = 0; l < ij.size(); ++l)
+			getEntry(x[l], A, ij[l].first, ij[l].second);
+		return x;
+	}
+
+	template <class Vector, class BB1, class BB2>
+	Vector& getEntries(Vector& x, const Compose<BB1, BB2>& A, const std::vector<std::pair<size_t, size_t> >& ij)
+	{
+		if (composeLength(A) != 2)
+			return getEntries(x, A, ij, SolutionTags::Generic());
+		typename EntriesCategory<BB1>::Tag t1;
+		typename EntriesCategory<BB2>::Tag t2;
+		return productEntries(x, A, ij, t1, t2);
+	}
+
+	template <class Vector, class BB1, class BB2, class Tag1, class Tag2>
+	Vector& productEntries(Vector& x, const Compose<BB1, BB2>& A, const std::vector<std::pair<size_t, size_t> >& ij, Tag1 t1, Tag2 t2)
+	{
+		return getEntries(x, A, ij, SolutionTags::Generic());
+	}
+
+	/* (BC)_{ij} is the sum of B_{ik}C_{kj} over the k in both the row i
+	 * of B and the column j of C: the entries of these rows and columns
+	 * are sorted by (i,k) and (j,k) and intersected.
+	 */
+	template <class Vector, class BB1, class BB2>
+	Vector& productEntries(Vector& x, const Compose<BB1, BB2>& A, const std::vector<std::pair<size_t, size_t> >& ij,
+			       SolutionTags::Local t1, SolutionTags::Local t2)
+	{
+		typedef typename BB1::Field Field;
+		typedef typename Field::Element Element;
+		typedef std::pair<std::pair<size_t, size_t>, Element> Entry;
+		const Field& F = A.field();
+
+		std::vector<bool> rows(A.rowdim(), false), cols(A.coldim(), false);
+		for (size_t l = 0; l < ij.size(); ++l) {
+			rows[ij[l].first] = true;
+			cols[ij[l].second] = true;
+		}
+		std::vector<Entry> L, R;
+		forEachEntry(*A.getLeftPtr(), [&] (size_t i, size_t k, const Element& a) {
+			if (rows[i]) L.push_back(Entry(std::make_pair(i, k), a));
+		});
+		forEachEntry(*A.getRightPtr(), [&] (size_t k, size_t j, const Element& b) {
+			if (cols[j]) R.push_back(Entry(std::make_pair(j, k), b));
+		});
+		auto position = [] (const Entry& u, const Entry& v) { return u.first < v.first; };
+		std::sort(L.begin(), L.end(), position);
+		std::sort(R.begin(), R.end(), position);
+		auto line = [] (const std::vector<Entry>& E, size_t i) {
+			auto first = [] (const Entry& u, size_t r) { return u.first.first < r; };
+			return std::make_pair(std::lower_bound(E.begin(), E.end(), i, first),
+					      std::lower_bound(E.begin(), E.end(), i+1, first));
+		};
+
+		x.resize(ij.size());
+		Element sa, sb;
+		for (size_t l = 0; l < ij.size(); ++l) {
+			F.assign(x[l], F.zero);
+			auto a = line(L, ij[l].first), b = line(R, ij[l].second);
+			while (a.first != a.second && b.first != b.second) {
+				const size_t ka = a.first->first.second, kb = b.first->first.second;
+				if (ka < kb) { ++a.first; continue; }
+				if (kb < ka) { ++b.first; continue; }
+				// the terms listed for B_{ik} and C_{kj}
+				F.assign(sa, F.zero);
+				F.assign(sb, F.zero);
+				for (; a.first != a.second && a.first->first.second == ka; ++a.first)
+					F.addin(sa, a.first->second);
+				for (; b.first != b.second && b.first->first.second == ka; ++b.first)
+					F.addin(sb, b.first->second);
+				F.axpyin(x[l], sa, sb);
+			}
+		}
+		return x;
+	}
+
+	/*-------- diagonal --------*/
+
+	template <class Vector, class BB>
+	Vector& getDiagonal(Vector& d, const BB& A)
+	{
+		typename GetEntryCategory<BB>::Tag t;
+		return getDiagonal(d, A, t);
+	}
+
+	template <class Vector, class BB>
+	Vector& getDiagonal(Vector& d, const BB& A, SolutionTags::Local t)
+	{
+		d.resize(std::min(A.rowdim(), A.coldim()));
+		for (size_t i = 0; i < d.size(); ++i)
+			A.getEntry(d[i], i, i);
+		return d;
+	}
+
+	// getEntries on the diagonal positions, which follows the structure of A
+	template <class Vector, class BB>
+	Vector& getDiagonal(Vector& d, const BB& A, SolutionTags::Generic t)
+	{
+		std::vector<std::pair<size_t, size_t> > ii(std::min(A.rowdim(), A.coldim()));
+		for (size_t i = 0; i < ii.size(); ++i)
+			ii[i] = std::make_pair(i, i);
+		return getEntries(d, A, ii);
+	}
+
 }
 
 #endif // __LINBOX_getentry_INL
@@ -100,8 +100,12 @@ namespace LinBox
 		// this can be a hybrid of EliminationMinpoly and BlasElimination (which means use LU here)
 		// It will be faster to do EliminationMinpoly when deg(m_A) is low.
 
-		// right now it is just BlasElimination
-		return isPositiveDefinite(A, tag, Method::BlasElimination(M));
+		// right now it is the Cholesky screen, then the signs of the charpoly
+		BlasMatrix<typename Blackbox::Field> DA(A.field(), A.rowdim(), A.coldim());
+		MatrixHom::map(DA, A); //! @warning this is a copy
+		int s = Signature::choleskyScreen(DA, false);
+		if (s >= 0) return s == 1;
+		return Signature::isPosDef(DA, Signature::Charpoly_Method() );
 	}
 
 	// The isPositiveDefinite with BlackBox Method
@@ -136,6 +140,8 @@ namespace LinBox
 		// call BlasElimination code
 		BlasMatrix<typename Blackbox::Field> DA(A.field(), A.rowdim(), A.coldim());
 		MatrixHom::map(DA, A); //! @bug why map (same field)? This is a copy.
+		int s = Signature::choleskyScreen(DA, false);
+		if (s >= 0) return s == 1;
 		return Signature::isPosDef(DA, Signature::BLAS_LPM_Method() );
 	}
 
@@ -146,6 +152,8 @@ namespace LinBox
 				 const Method::BlasElimination       &M)
 	{
 		// call BlasElimination code
+		int s = Signature::choleskyScreen(A, false);
+		if (s >= 0) return s == 1;
 		return Signature::isPosDef(A, Signature::BLAS_LPM_Method() );
 	}
 
@@ -98,8 +98,12 @@ namespace LinBox
 		// this can be a hybrid of EliminationMinpoly and BlasElimination (which means use LU here)
 		// It will be faster to do EliminationMinpoly when deg(m_A) is low.
 
-		// right now it is just BlasElimination
-		return isPositiveSemiDefinite(A, tag, Method::BlasElimination(M));
+		// right now it is the Cholesky screen, then the signs of the charpoly
+		BlasMatrix<typename Blackbox::Field> DA(A.field(), A.rowdim(), A.coldim());
+		MatrixHom::map(DA, A); //! @warning this is a copy
+		int s = Signature::choleskyScreen(DA, true);
+		if (s >= 0) return s == 1;
+		return Signature::isPosSemiDef(DA, Signature::Charpoly_Method() );
 	}
 
 	// The isPositiveSemiDefinite with BlackBox Method
@@ -134,6 +138,8 @@ namespace LinBox
 		// call BlasElimination code
 		BlasMatrix<typename Blackbox::Field> DA(A.field(), A.rowdim(), A.coldim());
 		MatrixHom::map(DA, A); //! @warning this is a copy
+		int s = Signature::choleskyScreen(DA, true);
+		if (s >= 0) return s == 1;
 		return Signature::isPosSemiDef(DA, Signature::BLAS_LPM_Method() );
 	}
 
@@ -145,6 +151,8 @@ namespace LinBox
 				     const Method::BlasElimination       &M)
 	{
 		// call BlasElimination code
+		int s = Signature::choleskyScreen(A, true);
+		if (s >= 0) return s == 1;
 		return Signature::isPosSemiDef(A, Signature::BLAS_LPM_Method() );
 	}
 
@@ -55,6 +55,12 @@
 #  define DEFAULT_EARLY_TERM_THRESHOLD 20
 #endif
 
+// Number of primes whose residues are buffered by the multiple CRA
+// before being reconstructed at once through a product tree
+#ifndef DEFAULT_CRA_BATCH_SIZE
+#  define DEFAULT_CRA_BATCH_SIZE 32
+#endif
+
 #ifdef __LINBOX_HAVE_MPI
 #include "linbox/util/mpicpp.h"
 #endif
@@ -393,7 +399,8 @@ namespace LinBox
 		 */
 		BlockLanczosTraits (Preconditioner Precond        = FULL_DIAGONAL,
 				    unsigned long  MaxTries       = 100,
-				    int            BlockingFactor = 16)
+				    int            BlockingFactor = 16) :
+			_checkpointInterval (1000)
 		{
 			Specifier::_preconditioner = (Precond);
 			Specifier::_maxTries       = (MaxTries);
@@ -401,8 +408,22 @@ namespace LinBox
 		}
 
 		BlockLanczosTraits( const Specifier& S) :
-		      	Specifier(S)
+		      	Specifier(S), _checkpointInterval (1000)
 	       	{}
+
+		/** File in which the state of the iteration is saved, so that an
+		 * interrupted run can resume. Empty (the default) for none.
+		 */
+		const std::string &checkpointFile () const { return _checkpointFile; }
+		/// Number of iterations between two checkpoints
+		unsigned long checkpointInterval () const { return _checkpointInterval; }
+
+		void checkpointFile (const std::string &f)   { _checkpointFile = f; }
+		void checkpointInterval (unsigned long n)    { _checkpointInterval = n; }
+
+	protected:
+		std::string   _checkpointFile;
+		unsigned long _checkpointInterval;
 	};
 
 	///
@@ -693,6 +714,12 @@ namespace LinBox
 	template<class Field, class _Rep>
 	bool useBB(const BlasMatrix<Field,_Rep>& A) { return false; }
 
+	template<class _Field>
+	class TiledBlasMatrix ; // forward declaration...
+
+	template<class Field>
+	bool useBB(const TiledBlasMatrix<Field>& A) { return false; }
+
 
 	/** Solver traits.
 	 *
@@ -27,18 +27,62 @@
 
 /** \file linbox/solutions/nullspace.h
  * @brief Nullspace solutions.
+ * Dense matrix nullspace and reduced row echelon form on <code>Z/pZ</code>.
  * This file will eventually comprehend :
- * - Dense matrix nullspace on Integers or <code>Z/pZ</code>
+ * - Dense matrix nullspace on Integers
  * - Sparse matrix nullspace
  * - Random element in the nullspace
  */
 
+#include "linbox/matrix/dense-matrix.h"
+#include "linbox/algorithms/dense-nullspace.h"
+#include "linbox/algorithms/echelon-form.h"
+
 namespace LinBox
 {
-#error "you don't want to include this file for now."
+
+	/** \brief Basis of the nullspace of a dense matrix.
+	 *
+	 * The columns of \p Ker (right nullspace) or its rows (left
+	 * nullspace) form a basis of the nullspace of \p A. The basis is built
+	 * from a \c PLUQ decomposition, in parallel with OpenMP.
+	 * @param[out] Ker the basis, resized
+	 * @param A a matrix over a finite field
+	 * @param Side \c Tag::Side::Right for \f$AX = 0\f$, \c Tag::Side::Left for \f$XA = 0\f$
+	 * @return the dimension of the nullspace
+	 */
+	template<class Field>
+	size_t nullspaceBasis (BlasMatrix<Field> & Ker, const BlasMatrix<Field> & A,
+			       const LINBOX_enum(Tag::Side) Side = Tag::Side::Right)
+	{
+		size_t kerdim ;
+		return NullSpaceBasisParallel(Side, A, Ker, kerdim);
+	}
+
+	//! Same as \c nullspaceBasis, \p A is overwritten.
+	template<class Field>
+	size_t nullspaceBasisIn (BlasMatrix<Field> & Ker, BlasMatrix<Field> & A,
+				 const LINBOX_enum(Tag::Side) Side = Tag::Side::Right)
+	{
+		size_t kerdim ;
+		return NullSpaceBasisParallelIn(Side, A, Ker, kerdim);
+	}
+
+	/** \brief Reduced row echelon form of a dense matrix.
+	 * @param[out] E its first \c rank rows get the echelon form, the others are untouched
+	 * @param A a matrix over a finite field
+	 * @return the rank of \p A
+	 */
+	template<class Field>
+	size_t rowReducedEchelon (BlasMatrix<Field> & E, const BlasMatrix<Field> & A)
+	{
+		EchelonFormDomain<Field> EFD (A.field());
+		return (size_t) EFD.rowReducedEchelonParallel(E, A);
+	}
+
 }
 
-#endif // __LINBOX_modulardense_nullspace_H
+#endif // __LINBOX_nullspace_H
 
 // Local Variables:
 // mode: C++
@@ -35,6 +35,7 @@
 #include "linbox/blackbox/compose.h"
 #include "linbox/blackbox/transpose.h"
 #include "linbox/blackbox/butterfly.h"
+#include "linbox/blackbox/fused-sparse.h"
 #include "linbox/algorithms/blackbox-container-symmetrize.h"
 #include "linbox/algorithms/blackbox-container-symmetric.h"
 #include "linbox/algorithms/blackbox-container.h"
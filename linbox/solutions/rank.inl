@@ -135,10 +135,13 @@ namespace LinBox
 				do iter.random (d1[i]); while (F.isZero (d1[i]));
 
 
-			typedef Compose<Compose<Diagonal<Field>,Blackbox >, Diagonal<Field> > BlackBox1;
+			// D A D, a scaled sparse operator when A allows it; the
+			// sparse copy of A is made once for all the attempts
+			FusedOperand<Blackbox> A_f (A);
+			typedef typename DiagonalScaled<Blackbox>::Operator BlackBox1;
 			Diagonal<Field> D_0 (d1);
-			Compose<Diagonal<Field>,Blackbox > B_0 (&D_0, &A);
-			BlackBox1 B (&B_0, &D_0);
+			DiagonalScaled<Blackbox> B_0 (D_0, A_f, D_0);
+			const BlackBox1& B = B_0.op();
 
 			BlackboxContainerSymmetric<Field, BlackBox1> TF (&B, F, iter);
 			MasseyDomain<Field, BlackboxContainerSymmetric<Field, BlackBox1> > WD (&TF, M.earlyTermThreshold ());
@@ -181,8 +184,8 @@ namespace LinBox
 				for (i = 0; i < A.coldim (); i++)
 					do iter.random (d1[i]); while (F.isZero (d1[i]));
 				Diagonal<Field> D1 (d1);
-				Compose<Diagonal<Field>,Blackbox > B1 (&D1, &A);
-				BlackBox1 B2 (&B1, &D1);
+				DiagonalScaled<Blackbox> B1 (D1, A_f, D1);
+				const BlackBox1& B2 = B1.op();
 
 				BlackboxContainerSymmetric<Field, BlackBox1> TF1 (&B2, F, iter);
 				MasseyDomain<Field, BlackboxContainerSymmetric<Field, BlackBox1> > WD1 (&TF1, M.earlyTermThreshold ());
@@ -269,16 +272,16 @@ namespace LinBox
 				do iter.random (d2[i]); while (F.isZero (d2[i]));
 
 			Diagonal<Field> D1_i (d1), D2_i (d2);
-			Transpose<Blackbox> AT_i (&A);
-
-			Compose<Diagonal<Field>,Transpose<Blackbox> > B1_i (&D1_i, &AT_i);
-			Compose<Compose<Diagonal<Field>,Transpose<Blackbox> >, Diagonal<Field> > B2_i (&B1_i, &D2_i);
-			Compose<Compose<Compose<Diagonal<Field>,Transpose<Blackbox> >, Diagonal<Field> >, Blackbox> B3_i (&B2_i, &A);
+			// B_i = D1 A^T D2 A D1, applied in a single traversal of A
+			// when A allows it; the sparse copy of A is made once for all
+			// the attempts.
+			FusedOperand<Blackbox> A_f (A);
 			// Here there is an extra diagonal computation
 			// The probability of success is also divided by two, as
 			// D2_i^2 contains only squares and squares are half the total elements
-			typedef Compose<Compose<Compose<Compose<Diagonal<Field>,Transpose<Blackbox> >, Diagonal<Field> >, Blackbox>, Diagonal<Field> > Blackbox0;
-			Blackbox0 B_i (&B3_i, &D1_i);
+			typedef typename ScaledNormal<Blackbox>::Operator Blackbox0;
+			ScaledNormal<Blackbox> N_i (A_f, D1_i, D2_i);
+			const Blackbox0& B_i = N_i.op();
 
 			BlackboxContainerSymmetric<Field, Blackbox0> TF_i (&B_i, F, iter);
 			MasseyDomain<Field, BlackboxContainerSymmetric<Field, Blackbox0> > WD (&TF_i, M.earlyTermThreshold ());
@@ -314,13 +317,9 @@ namespace LinBox
 					do iter.random (d2[i]); while (F.isZero (d2[i]));
 
 				Diagonal<Field> D1 (d1), D2 (d2);
-				Transpose<BlackboxP> AT (&BP);
-
-				Compose<Diagonal<Field>,Transpose<BlackboxP> > B1 (&D1, &AT);
-				Compose<Compose<Diagonal<Field>,Transpose<BlackboxP> >, Diagonal<Field> > B2 (&B1, &D2);
-				Compose<Compose<Compose<Diagonal<Field>,Transpose<BlackboxP> >, Diagonal<Field> >, BlackboxP> B3 (&B2, &BP);
-				typedef Compose<Compose<Compose<Compose<Diagonal<Field>,Transpose<BlackboxP> >, Diagonal<Field> >, BlackboxP>, Diagonal<Field> > Blackbox1;
-				Blackbox1 B (&B3, &D1);
+				typedef typename PermutedScaledNormal<Blackbox>::Operator Blackbox1;
+				PermutedScaledNormal<Blackbox> N (P, A_f, D1, D2);
+				const Blackbox1& B = N.op();
 
 				BlackboxContainerSymmetric<Field, Blackbox1> TF (&B, F, iter);
 				MasseyDomain<Field, BlackboxContainerSymmetric<Field, Blackbox1> > MD (&TF, M.earlyTermThreshold ());
@@ -450,6 +449,20 @@ namespace LinBox
 		return r;
 	}
 
+	// Out of core: the factorization stays on disk
+	template <class Field>
+	inline unsigned long &rank (unsigned long                      &r,
+				    const TiledBlasMatrix<Field>       &A,
+				    const RingCategories::ModularTag   &tag,
+				    const Method::BlasElimination      &M)
+	{
+		commentator().start ("Tiled Blas Rank", "tiledrank");
+		BlasMatrixDomain<Field> D(A.field());
+		r = D.rank(A);
+		commentator().stop ("done", NULL, "tiledrank");
+		return r;
+	}
+
 
 	template <class Blackbox, class MyMethod>
 	inline unsigned long &integral_rank (unsigned long	&r,
@@ -651,6 +664,29 @@ namespace LinBox { /*  rankin */
 			return rankin(r, A, tag, Method::BlasElimination(m));
 	}
 
+	/// A is modified.
+	template <class Field>
+	inline unsigned long &rankin (unsigned long                     &r,
+				      TiledBlasMatrix<Field>            &A,
+				      const RingCategories::ModularTag  &tag,
+				      const Method::BlasElimination     &M)
+	{
+		commentator().start ("Tiled Blas Rank", "tiledrank");
+		BlasMatrixDomain<Field> D(A.field());
+		r = D.rankin(A);
+		commentator().stop ("done", NULL, "tiledrank");
+		return r;
+	}
+
+	template <class Field>
+	inline unsigned long &rankin (unsigned long                     &r,
+				      TiledBlasMatrix<Field>            &A,
+				      const RingCategories::ModularTag  &tag,
+				      const Method::Elimination         &m)
+	{
+		return rankin(r, A, tag, Method::BlasElimination(m));
+	}
+
 
 
 
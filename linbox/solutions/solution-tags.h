@@ -42,6 +42,7 @@ namespace LinBox
 	template<class BB> struct TraceCategory;
 	template<class BB> struct DetCategory;
 	template<class BB> struct RankCategory;
+	template<class BB> struct EntriesCategory;
 }
 #endif // __LINBOX_solution_tags_H
 
@@ -37,6 +37,7 @@
 // must fix this list...
 #include "linbox/algorithms/gauss.h"
 #include "linbox/algorithms/gauss-gf2.h"
+#include "linbox/algorithms/gf2-block-lanczos.h"
 #include "linbox/algorithms/wiedemann.h"
 #include "linbox/algorithms/rational-solver.h"
 #include "linbox/algorithms/diophantine-solver.h"
@@ -309,6 +310,23 @@ namespace LinBox
 		return x;
 	}
 
+	//! @internal Elimination on Z/pZ for a matrix stored out of core, which must be nonsingular
+	template <class Vector, class Field>
+	Vector& solve(Vector& x, const TiledBlasMatrix<Field>& A, const Vector& b,
+		      const RingCategories::ModularTag & tag,
+		      const Method::BlasElimination& m)
+	{
+		if ((A.coldim() != x.size()) || (A.rowdim() != b.size()))
+			throw LinboxError("LinBox ERROR: dimension of data are not compatible in system solving (solving impossible)");
+
+		commentator().start ("Solving linear system (tiled PLUQ)", "TiledPLUQ::left_solve");
+		BlasMatrixDomain<Field> BMD(A.field());
+		BMD.left_solve(x, A, b);
+		commentator().stop ("done", NULL, "TiledPLUQ::left_solve");
+
+		return x;
+	}
+
 	template <class Vector, class Field>
 	Vector& solve(Vector& x, const BlasMatrix<Field>& A, const Vector& b,
 		      const RingCategories::ModularTag & tag,
@@ -671,6 +689,22 @@ namespace LinBox
 	// Lanczos ////////////////
 	// may throw SolverFailed or InconsistentSystem
 
+	//! @internal Block Lanczos on a sparse matrix over GF(2), 64 vectors to a word
+	// may throw SolveFailed
+	template <class Vector>
+	Vector& solve(Vector& x, const ZeroOne<GF2>& A, const Vector& b,
+		      const RingCategories::ModularTag & tag,
+		      const Method::BlockLanczos& m)
+	{
+		if ((A.coldim() != x.size()) || (A.rowdim() != b.size()))
+			throw LinboxError("LinBox ERROR: dimension of data are not compatible in system solving (solving impossible)");
+
+		GF2BlockLanczosSolver solver(A.field(), m);
+		if (!solver.solve(A, x, b))
+			throw SolveFailed();
+		return x;
+	}
+
 	// Wiedemann section ////////////////
 
 	// may throw SolverFailed or InconsistentSystem
@@ -38,6 +38,9 @@ namespace LinBox
 	  Runtime on n by n matrix is n times the cost of getEntry().
 	  This is linear in n for those classes where getEntry is constant time
 	  (eg DenseMatrix and SparseMatrix).
+	  For a product BC of blackboxes which list their entries (see
+	  getDiagonal), such as sparse matrices, the trace is read from the
+	  entries of B and C instead of n applies.
 	  Trace is constant time when the diagonal is necessarily constant, 
 	  eg. for ScalarMatrix and Toeplitz.
 	  Worst case time is cost of n blackbox applies (matrix vector products), 
@@ -47,17 +47,19 @@ namespace LinBox
 		return trace(t, A, tt);
 	}
 
-	/* Generic approach.  It will be efficient for BBs with efficient getEntry.
-	   If getEntry is constant time on n by n BB's, trace will be in O(n).
+	/* Generic approach.  The diagonal is read by getDiagonal: in O(n) for
+	   BBs with constant time getEntry, from the listed entries of the
+	   factors for sums and products of sparse or diagonal BBs, and by n
+	   applies otherwise.
 	   */
 	template <class BB>
 	typename BB::Field::Element& trace(typename BB::Field::Element& t, const BB& A, SolutionTags::Generic tt)
 	{
-		typename BB::Field::Element x;
-		A.field().assign(x, A.field().zero);
+		std::vector<typename BB::Field::Element> d;
+		getDiagonal(d, A);
 		A.field().assign(t, A.field().zero);
-		for (size_t i = 0; i < A.coldim(); ++i)
-			A.field().addin(t, getEntry(x,A,i,i));
+		for (size_t i = 0; i < d.size(); ++i)
+			A.field().addin(t, d[i]);
 		return t;
 	}
 
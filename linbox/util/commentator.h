@@ -49,6 +49,10 @@
 
 //#include "linbox/util/timer.h"
 #include "givaro/givtimer.h"
+#include "linbox/linbox-config.h"
+#ifdef __LINBOX_USE_OPENMP
+#include <omp.h>
+#endif
 
 #ifndef MAX
 #  define MAX(a,b) (((a) > (b)) ? (a) : (b))
@@ -995,8 +999,16 @@ namespace LinBox
 namespace LinBox
 {
 	// Default static commentator
+	// It is not thread safe: within an OpenMP parallel region, each
+	// thread reports to its own commentator, which prints nothing.
     Commentator& commentator() {
         static Commentator internal_static_commentator;
+#ifdef __LINBOX_USE_OPENMP
+        if (omp_in_parallel()) {
+            static thread_local Commentator thread_commentator;
+            return thread_commentator;
+        }
+#endif
         return internal_static_commentator;
     }
     Commentator& commentator(std::ostream& stream) {
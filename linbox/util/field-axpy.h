@@ -27,6 +27,12 @@
 #ifndef __LINBOX_util_field_axpy_H
 #define __LINBOX_util_field_axpy_H
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+
 // Namespace in which all LinBox library code resides
 namespace LinBox
 {
@@ -116,6 +122,154 @@ namespace LinBox
 
 	}; // class FieldAXPY
 
+#ifdef __SIZEOF_INT128__
+	/** Delayed reduction in a 128-bit accumulator.
+	 *
+	 * Common part of the FieldAXPY of the fields whose products do not
+	 * fit, or only a few times, in 64 bits: <code>Modular<int64_t></code>,
+	 * <code>Modular<uint64_t></code>, <code>ModularBalanced<int64_t></code>
+	 * and <code>PIRModular<int32_t></code>.
+	 * \p Wide is <code>unsigned __int128</code> for elements in \f$[0,p)\f$
+	 * and <code>__int128</code> for balanced ones.
+	 *
+	 * If the elements are bounded by \f$m\f$ in absolute value, the
+	 * accumulator, below \f$p\f$ after a reduction, can take
+	 * \f$k = \lfloor (W-p)/m^2 \rfloor\f$ more products, where \f$W\f$
+	 * is the largest \p Wide; \f$k \geq 16\f$ for \f$p < 2^{62}\f$, and
+	 * the reduction by \f$p\f$ is never needed for 32-bit moduli.
+	 *
+	 * The batch \c mulacc add up a whole dot product, in blocks of \f$k\f$
+	 * products without any test in the inner loop.
+	 */
+	template <class Field, class Wide>
+	class DelayedFieldAXPY {
+	public:
+
+		typedef typename Field::Element Element;
+		typedef Wide Abnormal;
+
+		/** Constructor.
+		 * @param F field
+		 * @param m bound on the absolute value of the elements of \p F
+		 */
+		DelayedFieldAXPY (const Field &F, uint64_t m) :
+			_field (&F), _y (0)
+		{
+			typedef unsigned __int128 uint128;
+			const uint128 W = (Wide(-1) < Wide(0)) ? (~uint128(0)) >> 1 : ~uint128(0);
+			const uint64_t p = (uint64_t) F.characteristic();
+			_p = (Wide) p;
+			if (!m) m = 1;
+			const uint128 k = (W - p) / ((uint128) m * (uint128) m);
+			_k = (k > (uint128) std::numeric_limits<size_t>::max()) ?
+				std::numeric_limits<size_t>::max() : (size_t) k;
+			_left = _k;
+		}
+
+		inline Abnormal& mulacc (const Element &a, const Element &x)
+		{
+			if (!_left) _reduce();
+			--_left;
+			return _y += (Wide) a * (Wide) x;
+		}
+
+		//! y += a[0]*x[0] + ... + a[n-1]*x[n-1], \p a and \p x random access
+		template <class Iterator1, class Iterator2>
+		inline Abnormal& mulacc (Iterator1 a, Iterator1 a_end, Iterator2 x)
+		{
+			size_t n = (size_t) std::distance (a, a_end);
+			while (n) {
+				if (!_left) _reduce();
+				const size_t b = std::min (n, _left);
+				Wide y = _y;
+				for (Iterator1 e = a + (ptrdiff_t) b; a != e; ++a, ++x)
+					y += (Wide) *a * (Wide) *x;
+				_y = y;
+				_left -= b;
+				n -= b;
+			}
+			return _y;
+		}
+
+		//! y += a[0]*x[i[0]] + ... , the sparse dot product
+		template <class IndexIterator, class Iterator, class Vector>
+		inline Abnormal& mulacc (IndexIterator i, IndexIterator i_end, Iterator a, const Vector &x)
+		{
+			size_t n = (size_t) std::distance (i, i_end);
+			while (n) {
+				if (!_left) _reduce();
+				const size_t b = std::min (n, _left);
+				Wide y = _y;
+				for (IndexIterator e = i + (ptrdiff_t) b; i != e; ++i, ++a)
+					y += (Wide) *a * (Wide) x[*i];
+				_y = y;
+				_left -= b;
+				n -= b;
+			}
+			return _y;
+		}
+
+		inline Abnormal& accumulate (const Element &t)
+		{
+			if (!_left) _reduce();
+			--_left;
+			return _y += (Wide) t;
+		}
+
+		inline Abnormal& accumulate_special (const Element &t)
+		{
+			return accumulate (t);
+		}
+
+		//! the remainder, in \f$[0,p)\f$ or \f$(-p,p)\f$ for a signed \p Wide
+		inline Element& get (Element &y) const
+		{
+			return y = (Element) (_y % _p);
+		}
+
+		inline DelayedFieldAXPY &assign (const Element y)
+		{
+			_y = (Wide) y;
+			_left = _k;
+			return *this;
+		}
+
+		inline void reset()
+		{
+			_y = 0;
+			_left = _k;
+		}
+
+		inline const Field & field() const { return *_field; }
+
+		//! number of products summed between two reductions
+		inline size_t delay() const { return _k; }
+
+		//! reduces a sum \p s kept outside, of at most \c delay() products
+		inline Wide& reducein (Wide &s) const { return s %= _p; }
+
+		//! \p y gets the remainder of a sum \p s kept outside, as in \c get
+		inline Element& reduce (Element &y, const Wide &s) const
+		{
+			return y = (Element) (s % _p);
+		}
+
+	protected:
+
+		const Field *_field;
+		Wide _y;
+		Wide _p;
+		size_t _k;    //!< products allowed after a reduction
+		size_t _left; //!< products allowed before the next one
+
+		inline void _reduce()
+		{
+			_y %= _p;
+			_left = _k;
+		}
+	}; // class DelayedFieldAXPY
+#endif // __SIZEOF_INT128__
+
 } // namespace LinBox
 
 #endif // __LINBOX_util_field_axpy_H
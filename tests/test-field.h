@@ -44,6 +44,9 @@ bool testRingArithmeticConsistency
 bool testAxpyConsistency
 bool testRanditerBasic
 
+// called directly by the tests of the fields with delayed FieldAXPY reductions.
+bool testFieldAXPY
+
 // top level runPIRTests calls these field_subtests after runBasicRingTests.
 bool testFieldCommutativity
 ...
@@ -68,6 +71,7 @@ bool testRingTrivia
 
 #include "linbox/util/commentator.h"
 #include "linbox/util/field-axpy.h"
+#include "linbox/vector/vector-domain.h"
 #include <givaro/givranditer.h>
 //#include "linbox/vector/stream.h"
 #include "linbox/integer.h"
@@ -1203,6 +1207,65 @@ namespace field_subtests {
 		return ret;
 	}
 
+	/** Generic test 8b: delayed reductions of FieldAXPY
+	 *
+	 * Sums n products, mostly of the elements of largest absolute value,
+	 * with FieldAXPY and with VectorDomain::dot, and compares with a sum
+	 * of axpyin. For the fields with 64-bit elements the sum has to be
+	 * reduced several times.
+	 */
+	template <class Field>
+	bool testFieldAXPY (const Field &F, const char *name, size_t n)
+	{
+		std::ostringstream str;
+		str << "\t--Testing " << name << " FieldAXPY delayed reductions" << ends;
+		commentator().start (str.str().c_str(), "testFieldAXPY");
+
+		bool ret = true;
+
+		LinBox::integer c;
+		F.characteristic (c);
+		typename Field::Element big[2], e, d;
+		F.init (big[0], (int64_t)-1);
+		F.init (big[1], c/2);
+
+		typename Field::RandIter r (F);
+		std::vector<typename Field::Element> u (n), v (n);
+		for (size_t i = 0; i < n; ++i) {
+			if (i % 3 == 2) {
+				r.random (u[i]);
+				r.random (v[i]);
+			}
+			else {
+				F.assign (u[i], big[i % 3]);
+				F.assign (v[i], big[(i / 3) % 2]);
+			}
+		}
+
+		F.assign (e, F.zero);
+		for (size_t i = 0; i < n; ++i)
+			F.axpyin (e, u[i], v[i]);
+
+		LinBox::FieldAXPY<Field> acc (F);
+		for (size_t i = 0; i < n; ++i)
+			acc.mulacc (u[i], v[i]);
+		acc.get (d);
+		if (!F.areEqual (d, e)) reportError ("FieldAXPY::mulacc differs from axpyin", ret);
+
+		acc.accumulate (big[0]);
+		acc.get (d);
+		F.addin (e, big[0]);
+		if (!F.areEqual (d, e)) reportError ("FieldAXPY::accumulate differs from addin", ret);
+		F.subin (e, big[0]);
+
+		LinBox::VectorDomain<Field> VD (F);
+		VD.dot (d, u, v);
+		if (!F.areEqual (d, e)) reportError ("VectorDomain::dot differs from axpyin", ret);
+
+		commentator().stop (MSG_STATUS (ret), (const char *) 0, "testFieldAXPY");
+		return ret;
+	}
+
 	/** Generic test 9: Basic concept check of RandIter
 	 *
 	 * In a loop, generates random element 'a', and fails